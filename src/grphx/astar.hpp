@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Binary min-heap of dense ids with decrease-key support.
+         */
+        class indexed_heap {
+        public:
+            static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+            /**
+             * @brief Makes room for ids in [0, capacity) and empties the heap.
+             */
+            void reserve(size_t capacity) {
+                this->clear();
+                if (this->m_position.size() < capacity) {
+                    this->m_position.resize(capacity, npos);
+                    this->m_keys.resize(capacity);
+                }
+            }
+
+            /**
+             * @brief Removes all ids in O(size()).
+             */
+            void clear() {
+                for (size_t id : this->m_heap) {
+                    this->m_position[id] = npos;
+                }
+                this->m_heap.clear();
+            }
+
+            bool empty() const {
+                return this->m_heap.empty();
+            }
+
+            /**
+             * @brief Inserts an id, or lowers its key if it is already in the heap with a larger one.
+             */
+            void push_or_decrease(size_t id, double key) {
+                if (this->m_position[id] == npos) {
+                    this->m_position[id] = this->m_heap.size();
+                    this->m_heap.push_back(id);
+                }
+                else if (key >= this->m_keys[id]) {
+                    return;
+                }
+
+                this->m_keys[id] = key;
+                this->sift_up(this->m_position[id]);
+            }
+
+            /**
+             * @brief Removes and returns the id with the smallest key.
+             */
+            size_t pop() {
+                const size_t top = this->m_heap.front();
+                this->swap_nodes(0, this->m_heap.size() - 1);
+                this->m_heap.pop_back();
+                this->m_position[top] = npos;
+                if (!this->m_heap.empty()) {
+                    this->sift_down(0);
+                }
+
+                return top;
+            }
+
+        private:
+            void swap_nodes(size_t a, size_t b) {
+                std::swap(this->m_heap[a], this->m_heap[b]);
+                this->m_position[this->m_heap[a]] = a;
+                this->m_position[this->m_heap[b]] = b;
+            }
+
+            void sift_up(size_t index) {
+                while (index > 0) {
+                    const size_t parent = (index - 1) / 2;
+                    if (this->m_keys[this->m_heap[parent]] <= this->m_keys[this->m_heap[index]])
+                        break;
+
+                    this->swap_nodes(parent, index);
+                    index = parent;
+                }
+            }
+
+            void sift_down(size_t index) {
+                for (;;) {
+                    const size_t left = 2 * index + 1;
+                    const size_t right = left + 1;
+                    size_t smallest = index;
+                    if (left < this->m_heap.size() && this->m_keys[this->m_heap[left]] < this->m_keys[this->m_heap[smallest]])
+                        smallest = left;
+                    if (right < this->m_heap.size() && this->m_keys[this->m_heap[right]] < this->m_keys[this->m_heap[smallest]])
+                        smallest = right;
+                    if (smallest == index)
+                        return;
+
+                    this->swap_nodes(smallest, index);
+                    index = smallest;
+                }
+            }
+
+            std::vector<size_t> m_heap;
+            std::vector<size_t> m_position;
+            std::vector<double> m_keys;
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief A path through a weighted graph together with its total weight.
+     */
+    template<typename T>
+    struct weighted_path {
+        std::vector<T> vertices;                                 ///< The vertices from source to target, empty if there is no path.
+        double length{ std::numeric_limits<double>::infinity() }; ///< The sum of the edge weights along the path.
+    };
+
+    /**
+     * @brief Reusable scratch memory for `astar`.
+     *
+     * The arrays are sized for the largest graph searched so far and invalidated in O(1) between
+     * queries with a generation counter, so repeated queries do not allocate.
+     */
+    class astar_workspace {
+    public:
+        /**
+         * @brief Prepares the workspace for a search over `size` vertices.
+         */
+        void prepare(size_t size) {
+            if (this->m_stamp.size() < size) {
+                this->m_stamp.resize(size, 0);
+                this->m_g.resize(size);
+                this->m_parent.resize(size);
+            }
+            this->m_open.reserve(size);
+
+            if (++this->m_generation == 0) {
+                std::fill(this->m_stamp.begin(), this->m_stamp.end(), 0);
+                this->m_generation = 1;
+            }
+        }
+
+        /**
+         * @brief Checks if a vertex was reached by the current search.
+         */
+        bool reached(size_t id) const {
+            return this->m_stamp[id] == this->m_generation;
+        }
+
+        /**
+         * @brief Returns the best known distance of a vertex reached by the current search.
+         */
+        double distance(size_t id) const {
+            return this->reached(id) ? this->m_g[id] : std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * @brief Records a better distance and parent for a vertex.
+         */
+        void relax(size_t id, double g, size_t parent) {
+            this->m_stamp[id] = this->m_generation;
+            this->m_g[id] = g;
+            this->m_parent[id] = parent;
+        }
+
+        size_t parent(size_t id) const {
+            return this->m_parent[id];
+        }
+
+        internal::indexed_heap& open() {
+            return this->m_open;
+        }
+
+    private:
+        std::vector<unsigned> m_stamp;
+        std::vector<double> m_g;
+        std::vector<size_t> m_parent;
+        internal::indexed_heap m_open;
+        unsigned m_generation{ 0 };
+    };
+
+    /**
+     * @brief A* search for a shortest weighted path.
+     *
+     * @param graph The graph to search; edge weights must be non-negative.
+     * @param source The first vertex of the path.
+     * @param target The last vertex of the path.
+     * @param heuristic Callable `double(const T&)` estimating the remaining distance to `target`; it must never overestimate.
+     * @param weight Callable `double(size_t edge)` returning the weight of the edge stored at `graph.targets()[edge]`.
+     * @param workspace Scratch memory reused across queries.
+     * @return The shortest path, or an empty path of infinite length if `target` is unreachable.
+     */
+    template<typename T, typename Heuristic, typename Weight>
+    weighted_path<T> astar(const csr_graph<T>& graph, const T& source, const T& target, Heuristic&& heuristic, Weight&& weight, astar_workspace& workspace) {
+        weighted_path<T> path;
+        const size_t s = graph.id_of(source);
+        const size_t t = graph.id_of(target);
+        if (s == csr_graph<T>::npos || t == csr_graph<T>::npos)
+            return path;
+
+        workspace.prepare(graph.size());
+        auto& open = workspace.open();
+        workspace.relax(s, 0.0, s);
+        open.push_or_decrease(s, heuristic(graph.vertex_at(s)));
+
+        while (!open.empty()) {
+            const size_t current = open.pop();
+            if (current == t)
+                break;
+
+            const double g = workspace.distance(current);
+            for (size_t e = graph.offsets()[current]; e < graph.offsets()[current + 1]; ++e) {
+                const size_t neighbor = graph.targets()[e];
+                const double candidate = g + weight(e);
+                if (candidate < workspace.distance(neighbor)) {
+                    // The heap holds every vertex at most once, so there are no stale entries to skip;
+                    // an inconsistent heuristic may put an expanded vertex back with a shorter distance
+                    workspace.relax(neighbor, candidate, current);
+                    open.push_or_decrease(neighbor, candidate + heuristic(graph.vertex_at(neighbor)));
+                }
+            }
+        }
+
+        if (!workspace.reached(t))
+            return path;
+
+        path.length = workspace.distance(t);
+        for (size_t v = t; v != s; v = workspace.parent(v)) {
+            path.vertices.push_back(graph.vertex_at(v));
+        }
+        path.vertices.push_back(graph.vertex_at(s));
+        std::reverse(path.vertices.begin(), path.vertices.end());
+
+        return path;
+    }
+
+    /**
+     * @brief A* search using the edge weights stored in the graph.
+     */
+    template<typename T, typename Heuristic>
+    weighted_path<T> astar(const csr_graph<T>& graph, const T& source, const T& target, Heuristic&& heuristic, astar_workspace& workspace) {
+        return astar(graph, source, target, std::forward<Heuristic>(heuristic), [&graph](size_t edge) { return graph.weight(edge); }, workspace);
+    }
+
+    /**
+     * @brief A* search using the edge weights stored in the graph and a temporary workspace.
+     */
+    template<typename T, typename Heuristic>
+    weighted_path<T> astar(const csr_graph<T>& graph, const T& source, const T& target, Heuristic&& heuristic) {
+        astar_workspace workspace;
+        return astar(graph, source, target, std::forward<Heuristic>(heuristic), workspace);
+    }
+
+} // end of namespace grphx
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "grphx.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Shared flag to cancel asynchronous traversals.
+     *
+     * Copies share the flag, so a caller keeps one copy and hands another to the traversal.
+     */
+    class cancellation_token {
+    public:
+        cancellation_token() : m_cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+        /**
+         * @brief Requests cancellation of every traversal holding a copy of this token.
+         */
+        void cancel() {
+            this->m_cancelled->store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Checks if cancellation was requested.
+         */
+        bool is_cancelled() const {
+            return this->m_cancelled->load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> m_cancelled;
+    };
+
+    /**
+     * @brief How an asynchronous traversal ended.
+     */
+    enum class traversal_status {
+        completed,        ///< The traversal ran to completion.
+        cancelled,        ///< The cancellation token was triggered.
+        deadline_exceeded ///< The deadline passed.
+    };
+
+    /**
+     * @brief Options of an asynchronous traversal.
+     */
+    struct traversal_options {
+        cancellation_token token;                                                            ///< Checked before every level.
+        std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::time_point::max() }; ///< Checked before every level.
+        bool partial_results{ true };                                                        ///< Keep the vertices found so far when stopped.
+    };
+
+    /**
+     * @brief The result of an asynchronous traversal.
+     */
+    template<typename T>
+    struct traversal_result {
+        std::vector<T> vertices;                               ///< The visited vertices or the path found.
+        traversal_status status{ traversal_status::completed }; ///< How the traversal ended.
+
+        /**
+         * @brief Checks if the traversal ran to completion.
+         */
+        bool completed() const {
+            return this->status == traversal_status::completed;
+        }
+    };
+
+    namespace internal {
+
+        inline bool should_stop(const traversal_options& options, traversal_status& status) {
+            if (options.token.is_cancelled()) {
+                status = traversal_status::cancelled;
+                return true;
+            }
+            if (std::chrono::steady_clock::now() >= options.deadline) {
+                status = traversal_status::deadline_exceeded;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Level-synchronous BFS that checks the options before expanding every level.
+         *
+         * Visits the vertices in the same order as `basic_graph::bfs`.
+         */
+        template<typename T>
+        traversal_result<T> bfs_until(const basic_graph<T>& graph, const T& start, const traversal_options& options) {
+            traversal_result<T> result;
+            std::unordered_set<T> seen{ start };
+            result.vertices.push_back(start);
+
+            for (size_t begin = 0; begin < result.vertices.size();) {
+                if (should_stop(options, result.status)) {
+                    if (!options.partial_results)
+                        result.vertices.clear();
+                    return result;
+                }
+
+                const size_t end = result.vertices.size();
+                for (size_t i = begin; i < end; ++i) {
+                    for (const auto& neighbor : graph.successors(result.vertices[i])) {
+                        if (seen.insert(neighbor).second)
+                            result.vertices.push_back(neighbor);
+                    }
+                }
+                begin = end;
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        traversal_result<T> shortest_path_until(const basic_graph<T>& graph, const T& source, const T& target, const traversal_options& options) {
+            traversal_result<T> result;
+            graph.shortest_path_until(source, target, result.vertices, [&options, &result]() {
+                return should_stop(options, result.status);
+            });
+            return result;
+        }
+
+        /**
+         * @brief Runs `function` through `executor` and returns a future of its result.
+         */
+        template<typename Executor, typename Function>
+        auto submit(Executor&& executor, Function&& function) -> std::future<decltype(function())> {
+            // std::function needs a copyable target, so the task is shared
+            auto task = std::make_shared<std::packaged_task<decltype(function())()>>(std::forward<Function>(function));
+            auto future = task->get_future();
+            executor(std::function<void()>([task]() { (*task)(); }));
+            return future;
+        }
+
+    } // end of namespace internal
+
+    /**
+     * @brief Runs a task on the calling thread, e.g. to await a traversal synchronously or in tests.
+     */
+    struct inline_executor {
+        void operator()(const std::function<void()>& task) const {
+            task();
+        }
+    };
+
+    /**
+     * @brief Breadth-First Search (BFS) on an executor.
+     *
+     * The traversal visits vertices level by level and checks the cancellation token and the
+     * deadline before every level. The graph must outlive the traversal and must not change
+     * while it runs. Concurrent traversals of one graph are safe; with
+     * `GRPHX_ENABLE_INSTRUMENTATION` their queries serialize briefly on the statistics lock.
+     *
+     * @param graph The graph.
+     * @param start The starting vertex for BFS traversal.
+     * @param options The cancellation token, deadline and whether to keep partial results.
+     * @param executor Callable `void(std::function<void()>)` that runs the task, e.g. by posting it to a thread pool.
+     * @return A future of the visited vertices and how the traversal ended.
+     */
+    template<typename T, typename Executor>
+    std::future<traversal_result<T>> bfs_async(const internal::basic_graph<T>& graph, T start, traversal_options options, Executor&& executor) {
+        return internal::submit(std::forward<Executor>(executor), [&graph, start, options]() {
+            return internal::bfs_until(graph, start, options);
+        });
+    }
+
+    /**
+     * @brief Breadth-First Search (BFS) on a new thread.
+     *
+     * @see bfs_async(const internal::basic_graph<T>&, T, traversal_options, Executor&&)
+     */
+    template<typename T>
+    std::future<traversal_result<T>> bfs_async(const internal::basic_graph<T>& graph, T start, traversal_options options = {}) {
+        return std::async(std::launch::async, [&graph, start, options]() {
+            return internal::bfs_until(graph, start, options);
+        });
+    }
+
+    /**
+     * @brief Finds a shortest path, counted in edges, on an executor.
+     *
+     * Runs the bidirectional search of `shortest_path` and checks the cancellation token and the
+     * deadline before every level. A stopped search has no partial path, so `vertices` is empty
+     * unless the status is `completed`. The graph must outlive the search and must not change
+     * while it runs.
+     *
+     * @param graph The graph.
+     * @param source The first vertex of the path.
+     * @param target The last vertex of the path.
+     * @param options The cancellation token and deadline.
+     * @param executor Callable `void(std::function<void()>)` that runs the task.
+     * @return A future of the path, empty if `target` is unreachable, and how the search ended.
+     */
+    template<typename T, typename Executor>
+    std::future<traversal_result<T>> shortest_path_async(const internal::basic_graph<T>& graph, T source, T target, traversal_options options, Executor&& executor) {
+        return internal::submit(std::forward<Executor>(executor), [&graph, source, target, options]() {
+            return internal::shortest_path_until(graph, source, target, options);
+        });
+    }
+
+    /**
+     * @brief Finds a shortest path, counted in edges, on a new thread.
+     *
+     * @see shortest_path_async(const internal::basic_graph<T>&, T, T, traversal_options, Executor&&)
+     */
+    template<typename T>
+    std::future<traversal_result<T>> shortest_path_async(const internal::basic_graph<T>& graph, T source, T target, traversal_options options = {}) {
+        return std::async(std::launch::async, [&graph, source, target, options]() {
+            return internal::shortest_path_until(graph, source, target, options);
+        });
+    }
+
+} // end of namespace grphx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Without -mpopcnt the builtin becomes a table-free bit trick or a libcall, so word loops pick a
+// popcnt-enabled clone at run time
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(__POPCNT__)
+#define GRPHX_POPCNT_DISPATCH 1
+#endif
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Counts the set bits of a word; usable in constant expressions.
+         */
+        constexpr size_t popcount64(std::uint64_t x) {
+            x = x - ((x >> 1) & 0x5555555555555555ULL);
+            x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+            x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<size_t>((x * 0x0101010101010101ULL) >> 56);
+        }
+
+        /**
+         * @brief Returns the index of the lowest set bit of a non-zero word; usable in constant expressions.
+         */
+        constexpr size_t lowest_bit64(std::uint64_t x) {
+            return popcount64((x & (~x + 1)) - 1);
+        }
+
+        /**
+         * @brief Counts the set bits of a word with the hardware instruction if the build targets it.
+         */
+        inline size_t popcount(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<size_t>(__popcnt64(x));
+#else
+            return popcount64(x);
+#endif
+        }
+
+        /**
+         * @brief Counts the set bits of `size` words, or of the AND of two word arrays if `mask` is not null.
+         */
+        inline size_t popcount_words_generic(const std::uint64_t* words, const std::uint64_t* mask, size_t size) {
+            size_t total{ 0 };
+            for (size_t w = 0; w < size; ++w) {
+                total += popcount(mask != nullptr ? words[w] & mask[w] : words[w]);
+            }
+            return total;
+        }
+
+#if defined(GRPHX_POPCNT_DISPATCH)
+        /**
+         * @brief The same loop compiled for the `popcnt` instruction; only called on CPUs that have it.
+         */
+        __attribute__((target("popcnt"))) inline size_t popcount_words_popcnt(const std::uint64_t* words, const std::uint64_t* mask, size_t size) {
+            size_t total{ 0 };
+            for (size_t w = 0; w < size; ++w) {
+                total += static_cast<size_t>(__builtin_popcountll(mask != nullptr ? words[w] & mask[w] : words[w]));
+            }
+            return total;
+        }
+
+        inline bool cpu_has_popcnt() {
+            static const bool supported = []() {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("popcnt") != 0;
+            }();
+            return supported;
+        }
+#endif
+
+        /**
+         * @brief Counts the set bits of `size` contiguous words with the hardware instruction when the CPU has one.
+         *
+         * @param words The words.
+         * @param mask If not null, every word is ANDed with the word at the same position first.
+         * @param size The number of words.
+         */
+        inline size_t popcount_words(const std::uint64_t* words, const std::uint64_t* mask, size_t size) {
+#if defined(GRPHX_POPCNT_DISPATCH)
+            if (cpu_has_popcnt())
+                return popcount_words_popcnt(words, mask, size);
+#endif
+            return popcount_words_generic(words, mask, size);
+        }
+
+        /**
+         * @brief Returns the index of the lowest set bit of a non-zero word.
+         */
+        inline size_t lowest_bit(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(x));
+#else
+            return lowest_bit64(x);
+#endif
+        }
+
+    } // end of namespace internal
+
+} // end of namespace grphx
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Per-thread scratch arrays of Brandes' algorithm, allocated once per worker.
+         */
+        struct brandes_workspace {
+            explicit brandes_workspace(size_t size)
+                : distance(size, std::numeric_limits<size_t>::max()), sigma(size, 0.0), delta(size, 0.0) {
+                order.reserve(size);
+            }
+
+            std::vector<size_t> distance;
+            std::vector<double> sigma;
+            std::vector<double> delta;
+            std::vector<size_t> order;
+        };
+
+        /**
+         * @brief Adds the dependencies of all vertices on one source to `centrality`.
+         *
+         * Predecessors are not stored: on the way back `v` is a predecessor of its successor `w`
+         * exactly when `distance[w] == distance[v] + 1`. Only the entries touched by the search
+         * are reset afterwards.
+         */
+        template<typename T>
+        void brandes_source(const csr_graph<T>& graph, size_t source, brandes_workspace& workspace, std::vector<double>& centrality) {
+            const size_t unreached = std::numeric_limits<size_t>::max();
+            auto& distance = workspace.distance;
+            auto& sigma = workspace.sigma;
+            auto& delta = workspace.delta;
+            auto& order = workspace.order;
+
+            order.clear();
+            order.push_back(source);
+            distance[source] = 0;
+            sigma[source] = 1.0;
+            for (size_t head = 0; head < order.size(); ++head) {
+                const size_t v = order[head];
+                for (const size_t* it = graph.row_begin(v); it != graph.row_end(v); ++it) {
+                    if (distance[*it] == unreached) {
+                        distance[*it] = distance[v] + 1;
+                        order.push_back(*it);
+                    }
+                    if (distance[*it] == distance[v] + 1) {
+                        sigma[*it] += sigma[v];
+                    }
+                }
+            }
+
+            for (size_t i = order.size(); i-- > 0;) {
+                const size_t v = order[i];
+                for (const size_t* it = graph.row_begin(v); it != graph.row_end(v); ++it) {
+                    if (distance[*it] == distance[v] + 1) {
+                        delta[v] += sigma[v] / sigma[*it] * (1.0 + delta[*it]);
+                    }
+                }
+                if (v != source) {
+                    centrality[v] += delta[v];
+                }
+            }
+
+            for (size_t v : order) {
+                distance[v] = unreached;
+                sigma[v] = 0.0;
+                delta[v] = 0.0;
+            }
+        }
+
+    } // end of namespace internal
+
+    /**
+     * @brief Betweenness centrality with Brandes' algorithm, in hops.
+     *
+     * The sources are split over `threads` workers, each with its own distance, path count and
+     * dependency arrays and its own centrality accumulator. With `sample_sources` set only that
+     * many sources, drawn from `seed`, are searched and the result is scaled by
+     * `size() / sample_sources` as an estimate of the exact value.
+     *
+     * Graphs built from an undirected graph count every pair once, as the textbook definition does.
+     *
+     * @param graph The graph.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @param sample_sources The number of sampled sources; 0 or at least `size()` for the exact value.
+     * @param seed The seed of the source sampling.
+     * @return The centrality of every vertex, indexed by dense id.
+     */
+    template<typename T>
+    std::vector<double> betweenness_centrality(const csr_graph<T>& graph, size_t threads = 0, size_t sample_sources = 0, std::uint64_t seed = 0) {
+        const size_t n = graph.size();
+        std::vector<size_t> sources(n);
+        std::iota(sources.begin(), sources.end(), size_t{ 0 });
+
+        double scale = graph.is_directed() ? 1.0 : 0.5;
+        if (sample_sources != 0 && sample_sources < n) {
+            // Partial Fisher-Yates shuffle driven by a counter-based generator
+            for (size_t i = 0; i < sample_sources; ++i) {
+                const size_t j = i + static_cast<size_t>(internal::mix64(seed ^ internal::mix64(i)) % (n - i));
+                std::swap(sources[i], sources[j]);
+            }
+            sources.resize(sample_sources);
+            scale *= static_cast<double>(n) / static_cast<double>(sample_sources);
+        }
+
+        std::vector<std::vector<double>> partial(internal::worker_count(threads, sources.size()));
+        internal::parallel_for(sources.size(), threads, [&](size_t worker, size_t begin, size_t end) {
+            internal::brandes_workspace workspace(n);
+            partial[worker].assign(n, 0.0);
+            for (size_t i = begin; i < end; ++i) {
+                internal::brandes_source(graph, sources[i], workspace, partial[worker]);
+            }
+        });
+
+        std::vector<double> centrality(n, 0.0);
+        for (const auto& values : partial) {
+            for (size_t v = 0; v < values.size(); ++v) {
+                centrality[v] += values[v];
+            }
+        }
+        for (double& value : centrality) {
+            value *= scale;
+        }
+
+        return centrality;
+    }
+
+    /**
+     * @brief Betweenness centrality of a directed graph.
+     *
+     * @see betweenness_centrality(const csr_graph<T>&, size_t, size_t, std::uint64_t)
+     * @return The centrality of every vertex.
+     */
+    template<typename T>
+    std::unordered_map<T, double> betweenness_centrality(const directed_graph<T>& graph, size_t threads = 0, size_t sample_sources = 0, std::uint64_t seed = 0) {
+        const csr_graph<T> csr(graph);
+        const std::vector<double> values = betweenness_centrality(csr, threads, sample_sources, seed);
+
+        std::unordered_map<T, double> centrality;
+        for (size_t id = 0; id < csr.size(); ++id) {
+            centrality.emplace(csr.vertex_at(id), values[id]);
+        }
+
+        return centrality;
+    }
+
+    /**
+     * @brief Betweenness centrality of an undirected graph.
+     *
+     * @see betweenness_centrality(const csr_graph<T>&, size_t, size_t, std::uint64_t)
+     * @return The centrality of every vertex.
+     */
+    template<typename T>
+    std::unordered_map<T, double> betweenness_centrality(const undirected_graph<T>& graph, size_t threads = 0, size_t sample_sources = 0, std::uint64_t seed = 0) {
+        const csr_graph<T> csr(graph);
+        const std::vector<double> values = betweenness_centrality(csr, threads, sample_sources, seed);
+
+        std::unordered_map<T, double> centrality;
+        for (size_t id = 0; id < csr.size(); ++id) {
+            centrality.emplace(csr.vertex_at(id), values[id]);
+        }
+
+        return centrality;
+    }
+
+} // end of namespace grphx
@@ -0,0 +1,584 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Read-only graph with compressed adjacency rows for integer vertices.
+     *
+     * Every sorted row is stored as a byte stream in the spirit of WebGraph: the out-degree, an
+     * optional reference to one of the previous `window` rows together with copy blocks selecting
+     * the neighbors shared with it, and the remaining neighbors as gaps. All numbers are written
+     * as variable-length integers, so rows of nearby ids cost one or two bytes per edge.
+     *
+     * When the vertices are exactly 0, 1, ..., size() - 1 in id order no key table is kept.
+     */
+    template<typename T>
+    class compressed_graph {
+        static_assert(std::is_integral<T>::value, "compressed_graph requires an integral vertex type");
+
+    public:
+        using vertex_id = typename csr_graph<T>::vertex_id;
+
+        static constexpr vertex_id npos = csr_graph<T>::npos;
+
+        class builder;
+
+        /**
+         * @brief Reusable buffers for decoding rows, so that a loop over many rows does not allocate.
+         */
+        struct decode_buffer {
+            std::vector<vertex_id> reference;
+            std::vector<vertex_id> copied;
+            std::vector<vertex_id> residuals;
+            std::vector<vertex_id> chain;
+        };
+
+        /**
+         * @brief Compresses a CSR graph.
+         *
+         * @param graph The graph to compress.
+         * @param window How many previous rows are candidates for a reference; 0 disables references.
+         * @param max_reference_chain The longest chain of references a row may depend on when decoded.
+         */
+        explicit compressed_graph(const csr_graph<T>& graph, size_t window = 7, size_t max_reference_chain = 3)
+            : m_size(graph.size()), m_edge_count(graph.edge_count()), m_offsets(1, 0) {
+            bool identity = true;
+            for (vertex_id id = 0; id < graph.size() && identity; ++id) {
+                identity = graph.vertex_at(id) == static_cast<T>(id);
+            }
+            if (!identity) {
+                this->m_vertices = graph.vertices();
+                for (vertex_id id = 0; id < graph.size(); ++id) {
+                    this->m_index.emplace(graph.vertex_at(id), id);
+                }
+            }
+
+            std::vector<size_t> chain(graph.size(), 0);
+            row_encoder encoder;
+            for (vertex_id v = 0; v < graph.size(); ++v) {
+                chain[v] = this->append_row(v, graph.row_begin(v), graph.row_end(v), window, max_reference_chain, encoder,
+                    [&](vertex_id u) { return std::make_pair(graph.row_begin(u), graph.row_end(u)); },
+                    [&](vertex_id u) { return chain[u]; });
+            }
+
+            this->m_bytes.shrink_to_fit();
+        }
+
+        /**
+         * @brief Returns the number of vertices in the graph.
+         */
+        size_t size() const {
+            return this->m_size;
+        }
+
+        /**
+         * @brief Returns the number of stored edges.
+         */
+        size_t edge_count() const {
+            return this->m_edge_count;
+        }
+
+        /**
+         * @brief Checks if the graph is empty.
+         */
+        bool is_empty() const {
+            return this->m_size == 0;
+        }
+
+        /**
+         * @brief Returns the number of bytes used by the encoded rows.
+         */
+        size_t encoded_size() const {
+            return this->m_bytes.size();
+        }
+
+        /**
+         * @brief Returns the dense id of a vertex, or `npos` if the vertex is not in the graph.
+         */
+        vertex_id id_of(const T& v) const {
+            if (this->m_vertices.empty()) {
+                if (std::is_signed<T>::value && v < T{})
+                    return npos;
+
+                return static_cast<std::uint64_t>(v) < this->m_size ? static_cast<vertex_id>(v) : npos;
+            }
+
+            auto it = this->m_index.find(v);
+            return it != this->m_index.end() ? it->second : npos;
+        }
+
+        /**
+         * @brief Returns the vertex with the given dense id.
+         */
+        T vertex_at(vertex_id id) const {
+            return this->m_vertices.empty() ? static_cast<T>(id) : this->m_vertices[id];
+        }
+
+        /**
+         * @brief Checks if the graph contains a vertex.
+         */
+        bool contains_vertex(T v) const {
+            return this->id_of(v) != npos;
+        }
+
+        /**
+         * @brief Checks if the graph contains an edge from vertex `u` to vertex `v`.
+         */
+        bool contains_edge(T u, T v) const {
+            const vertex_id iu = this->id_of(u);
+            const vertex_id iv = this->id_of(v);
+            if (iu == npos || iv == npos)
+                return false;
+
+            std::vector<vertex_id> row;
+            this->decode(iu, row);
+            return std::binary_search(row.begin(), row.end(), iv);
+        }
+
+        /**
+         * @brief Returns the out-degree of a vertex, or 0 if the vertex is not in the graph.
+         */
+        size_t out_degree(T v) const {
+            const vertex_id id = this->id_of(v);
+            if (id == npos)
+                return 0;
+
+            size_t position = this->m_offsets[id];
+            return static_cast<size_t>(this->read(position));
+        }
+
+        /**
+         * @brief Returns the list of successors of a vertex.
+         */
+        std::list<T> successors(T v) const {
+            std::list<T> successors;
+            const vertex_id id = this->id_of(v);
+            if (id == npos)
+                return successors;
+
+            std::vector<vertex_id> row;
+            decode_buffer buffer;
+            this->decode(id, row, buffer);
+            for (vertex_id neighbor : row) {
+                successors.push_back(this->vertex_at(neighbor));
+            }
+
+            return successors;
+        }
+
+        /**
+         * @brief Decodes the sorted neighbor ids of a dense id into `row`.
+         *
+         * @param id The dense id of the vertex.
+         * @param row Receives the neighbor ids; its previous content is discarded.
+         */
+        void decode(vertex_id id, std::vector<vertex_id>& row) const {
+            decode_buffer buffer;
+            this->decode(id, row, buffer);
+        }
+
+        /**
+         * @brief Decodes the sorted neighbor ids of a dense id into `row` using caller-owned buffers.
+         *
+         * The chain of referenced rows is followed iteratively and decoded from its oldest row forward,
+         * so neither the stack nor the number of buffers grows with its length.
+         *
+         * @param id The dense id of the vertex.
+         * @param row Receives the neighbor ids; its previous content is discarded.
+         * @param buffer Scratch space, reused across calls.
+         */
+        void decode(vertex_id id, std::vector<vertex_id>& row, decode_buffer& buffer) const {
+            buffer.chain.clear();
+            for (vertex_id current = id;;) {
+                buffer.chain.push_back(current);
+                size_t position = this->m_offsets[current];
+                if (this->read(position) == 0)
+                    break;
+
+                const vertex_id reference = static_cast<vertex_id>(this->read(position));
+                if (reference == 0)
+                    break;
+
+                current -= reference;
+            }
+
+            for (size_t i = buffer.chain.size(); i-- > 0;) {
+                this->decode_row(buffer.chain[i], row, buffer);
+                if (i > 0)
+                    row.swap(buffer.reference);
+            }
+        }
+
+        /**
+         * @brief Breadth-First Search (BFS) algorithm.
+         *
+         * @param start The starting vertex for BFS traversal.
+         * @return A vector containing the vertices visited during BFS traversal.
+         */
+        std::vector<T> bfs(T start) const {
+            std::vector<T> visited;
+            const vertex_id source = this->id_of(start);
+            if (source == npos)
+                return visited;
+
+            std::vector<bool> seen(this->m_size, false);
+            std::vector<vertex_id> row;
+            decode_buffer buffer;
+            std::queue<vertex_id> queue;
+            queue.push(source);
+            seen[source] = true;
+
+            while (!queue.empty()) {
+                const vertex_id current = queue.front();
+                queue.pop();
+                visited.push_back(this->vertex_at(current));
+
+                this->decode(current, row, buffer);
+                for (vertex_id neighbor : row) {
+                    if (!seen[neighbor]) {
+                        seen[neighbor] = true;
+                        queue.push(neighbor);
+                    }
+                }
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Estimates the memory used by the graph.
+         *
+         * @return The estimated heap and object footprint, broken down by purpose.
+         */
+        memory_breakdown memory_usage() const {
+            memory_breakdown usage;
+            usage.vertex_table = this->m_vertices.size() * sizeof(T);
+            usage.adjacency = this->m_bytes.size() + this->m_offsets.size() * sizeof(size_t);
+            usage.indexes = internal::hash_table_size(this->m_index.bucket_count(), this->m_index.size(), sizeof(std::pair<const T, vertex_id>));
+            usage.overhead = sizeof(*this)
+                + (this->m_bytes.capacity() - this->m_bytes.size())
+                + (this->m_offsets.capacity() - this->m_offsets.size()) * sizeof(size_t);
+
+            return usage;
+        }
+
+    private:
+        struct row_encoder {
+            std::vector<bool> shared;
+            std::vector<vertex_id> residuals;
+            std::vector<std::uint64_t> blocks;
+        };
+
+        compressed_graph()
+            : m_size(0), m_edge_count(0), m_offsets(1, 0) {
+        }
+
+        /**
+         * @brief Encodes the sorted row of `v` after the rows already written.
+         *
+         * @param row_of Returns the begin and end of the row of an earlier vertex within the window.
+         * @param chain_of Returns the reference chain length of an earlier vertex within the window.
+         * @return The reference chain length of the new row.
+         */
+        template<typename RowOf, typename ChainOf>
+        size_t append_row(vertex_id v, const vertex_id* begin, const vertex_id* end, size_t window, size_t max_reference_chain,
+            row_encoder& encoder, RowOf row_of, ChainOf chain_of) {
+            size_t depth{ 0 };
+            write(static_cast<std::uint64_t>(end - begin));
+
+            if (begin != end) {
+                // Pick the previous row sharing the most neighbors
+                vertex_id reference = 0;
+                size_t best_shared = 0;
+                for (vertex_id r = 1; r <= window && r <= v; ++r) {
+                    if (chain_of(v - r) >= max_reference_chain)
+                        continue;
+
+                    const auto candidate = row_of(v - r);
+                    const size_t common = count_common(begin, end, candidate.first, candidate.second);
+                    if (common > best_shared) {
+                        best_shared = common;
+                        reference = r;
+                    }
+                }
+
+                write(reference);
+                std::vector<vertex_id>& residuals = encoder.residuals;
+                residuals.clear();
+                if (reference == 0) {
+                    residuals.assign(begin, end);
+                }
+                else {
+                    depth = chain_of(v - reference) + 1;
+                    const auto referenced = row_of(v - reference);
+                    const vertex_id* ref_begin = referenced.first;
+                    const vertex_id* ref_end = referenced.second;
+                    std::vector<bool>& shared = encoder.shared;
+                    shared.assign(static_cast<size_t>(ref_end - ref_begin), false);
+
+                    const vertex_id* a = begin;
+                    const vertex_id* b = ref_begin;
+                    while (a != end) {
+                        if (b == ref_end || *a < *b) {
+                            residuals.push_back(*a++);
+                        }
+                        else if (*b < *a) {
+                            ++b;
+                        }
+                        else {
+                            shared[static_cast<size_t>(b - ref_begin)] = true;
+                            ++a;
+                            ++b;
+                        }
+                    }
+
+                    // Alternating copy/skip run lengths, starting with a copy run, without the trailing skip run
+                    std::vector<std::uint64_t>& blocks = encoder.blocks;
+                    blocks.clear();
+                    size_t i = 0;
+                    bool copying = true;
+                    while (i < shared.size()) {
+                        size_t run = 0;
+                        while (i < shared.size() && shared[i] == copying) {
+                            ++run;
+                            ++i;
+                        }
+                        blocks.push_back(run);
+                        copying = !copying;
+                    }
+                    if (!blocks.empty() && blocks.size() % 2 == 0) {
+                        blocks.pop_back();
+                    }
+
+                    write(blocks.size());
+                    for (std::uint64_t block : blocks) {
+                        write(block);
+                    }
+                }
+
+                // Residuals: the first relative to the row's own id (zig-zag, shifted unsigned), the others as gaps
+                for (size_t k = 0; k < residuals.size(); ++k) {
+                    if (k == 0) {
+                        const auto delta = static_cast<std::int64_t>(residuals[0]) - static_cast<std::int64_t>(v);
+                        write((static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63));
+                    }
+                    else {
+                        write(residuals[k] - residuals[k - 1] - 1);
+                    }
+                }
+            }
+
+            this->m_offsets.push_back(this->m_bytes.size());
+            return depth;
+        }
+
+        /**
+         * @brief Decodes one row whose referenced row, if any, is already decoded in `buffer.reference`.
+         */
+        void decode_row(vertex_id id, std::vector<vertex_id>& row, decode_buffer& buffer) const {
+            row.clear();
+            size_t position = this->m_offsets[id];
+            const size_t degree = static_cast<size_t>(this->read(position));
+            if (degree == 0)
+                return;
+
+            const vertex_id reference = static_cast<vertex_id>(this->read(position));
+            std::vector<vertex_id>& copied = buffer.copied;
+            copied.clear();
+            if (reference != 0) {
+                const std::vector<vertex_id>& reference_row = buffer.reference;
+                const size_t blocks = static_cast<size_t>(this->read(position));
+                size_t index = 0;
+                for (size_t b = 0; b < blocks; ++b) {
+                    const size_t run = static_cast<size_t>(this->read(position));
+                    if (b % 2 == 0) {
+                        copied.insert(copied.end(), reference_row.begin() + index, reference_row.begin() + index + run);
+                    }
+                    index += run;
+                }
+            }
+
+            std::vector<vertex_id>& residuals = buffer.residuals;
+            residuals.clear();
+            const size_t residual_count = degree - copied.size();
+            for (size_t k = 0; k < residual_count; ++k) {
+                const std::uint64_t value = this->read(position);
+                if (k == 0) {
+                    const auto delta = static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+                    residuals.push_back(static_cast<vertex_id>(static_cast<std::int64_t>(id) + delta));
+                }
+                else {
+                    residuals.push_back(residuals.back() + static_cast<vertex_id>(value) + 1);
+                }
+            }
+
+            row.resize(degree);
+            std::merge(copied.begin(), copied.end(), residuals.begin(), residuals.end(), row.begin());
+        }
+
+        static size_t count_common(const vertex_id* a, const vertex_id* a_end, const vertex_id* b, const vertex_id* b_end) {
+            size_t common{ 0 };
+            while (a != a_end && b != b_end) {
+                if (*a < *b) {
+                    ++a;
+                }
+                else if (*b < *a) {
+                    ++b;
+                }
+                else {
+                    ++common;
+                    ++a;
+                    ++b;
+                }
+            }
+
+            return common;
+        }
+
+        void write(std::uint64_t value) {
+            while (value >= 0x80) {
+                this->m_bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            this->m_bytes.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        std::uint64_t read(size_t& position) const {
+            std::uint64_t value{ 0 };
+            for (unsigned shift = 0;; shift += 7) {
+                const std::uint8_t byte = this->m_bytes[position++];
+                value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+        }
+
+        size_t m_size;
+        size_t m_edge_count;
+        std::vector<std::uint8_t> m_bytes;
+        std::vector<size_t> m_offsets;
+        std::vector<T> m_vertices;
+        std::unordered_map<T, vertex_id> m_index;
+    };
+
+    /**
+     * @brief Builds a compressed graph over the vertices 0, 1, ..., vertices - 1 from edges sorted by source.
+     *
+     * Only the rows inside the reference window are kept while building, so the graph never has to be
+     * materialized as a csr_graph first.
+     */
+    template<typename T>
+    class compressed_graph<T>::builder {
+    public:
+        /**
+         * @brief Creates a builder.
+         *
+         * @param vertices The number of vertices; sources and targets must be below it.
+         * @param window How many previous rows are candidates for a reference; 0 disables references.
+         * @param max_reference_chain The longest chain of references a row may depend on when decoded.
+         */
+        explicit builder(size_t vertices, size_t window = 7, size_t max_reference_chain = 3)
+            : m_vertices(vertices), m_window(window), m_max_reference_chain(max_reference_chain), m_rows(window + 1), m_chains(window + 1, 0) {
+            this->m_graph.m_size = vertices;
+        }
+
+        /**
+         * @brief Appends an edge; edges must be sorted by source and then by target.
+         *
+         * @throws std::invalid_argument if the edge is out of order or not between vertices of the graph.
+         */
+        void add_edge(T u, T v) {
+            if (!this->in_range(u) || !this->in_range(v) || this->m_finished)
+                throw std::invalid_argument("compressed graph builder: edges must be between existing vertices");
+
+            const auto source = static_cast<vertex_id>(u);
+            const auto target = static_cast<vertex_id>(v);
+            if (source < this->m_row || (source == this->m_row && !this->m_current.empty() && target < this->m_current.back()))
+                throw std::invalid_argument("compressed graph builder: edges must be sorted by source and target");
+
+            this->close_rows(source);
+            this->m_current.push_back(target);
+        }
+
+        /**
+         * @brief Appends the sorted row of a vertex; rows must be added in increasing order.
+         *
+         * @param u The source vertex.
+         * @param first The first target.
+         * @param last Past the last target.
+         */
+        template<typename Iterator>
+        void add_row(T u, Iterator first, Iterator last) {
+            for (; first != last; ++first) {
+                this->add_edge(u, static_cast<T>(*first));
+            }
+        }
+
+        /**
+         * @brief Encodes the remaining rows and returns the graph; the builder cannot be used afterwards.
+         */
+        compressed_graph finish() {
+            if (this->m_finished)
+                throw std::logic_error("compressed graph builder: already finished");
+
+            this->close_rows(this->m_vertices);
+            this->m_finished = true;
+            this->m_graph.m_bytes.shrink_to_fit();
+            return std::move(this->m_graph);
+        }
+
+    private:
+        bool in_range(T v) const {
+            if (std::is_signed<T>::value && v < T{})
+                return false;
+
+            return static_cast<std::uint64_t>(v) < this->m_vertices;
+        }
+
+        // Encodes the pending row and the empty rows up to, but not including, `until`
+        void close_rows(vertex_id until) {
+            const size_t slots = this->m_rows.size();
+            while (this->m_row < until) {
+                std::vector<vertex_id>& slot = this->m_rows[this->m_row % slots];
+                slot.swap(this->m_current);
+                this->m_current.clear();
+                this->m_graph.m_edge_count += slot.size();
+
+                this->m_chains[this->m_row % slots] = this->m_graph.append_row(this->m_row, slot.data(), slot.data() + slot.size(),
+                    this->m_window, this->m_max_reference_chain, this->m_encoder,
+                    [&](vertex_id u) {
+                        const std::vector<vertex_id>& row = this->m_rows[u % slots];
+                        return std::make_pair(row.data(), row.data() + row.size());
+                    },
+                    [&](vertex_id u) { return this->m_chains[u % slots]; });
+                ++this->m_row;
+            }
+        }
+
+        compressed_graph m_graph;
+        size_t m_vertices;
+        size_t m_window;
+        size_t m_max_reference_chain;
+        // The last window + 1 rows, indexed by vertex modulo their count
+        std::vector<std::vector<vertex_id>> m_rows;
+        std::vector<size_t> m_chains;
+        std::vector<vertex_id> m_current;
+        row_encoder m_encoder;
+        vertex_id m_row{ 0 };
+        bool m_finished{ false };
+    };
+
+} // end of namespace grphx
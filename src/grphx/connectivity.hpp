@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "spanning_tree.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Keeps the connected components of an undirected graph up to date as it changes.
+     *
+     * The tracker observes the graph. Every added edge is a union in a disjoint-set forest, so
+     * under insertions `connected` takes near-constant time. A removal may split a component,
+     * which union-find cannot undo: the component is only marked dirty, and the first query that
+     * needs its answer rebuilds that component alone from the graph. Vertices of the rebuilt
+     * component get fresh union-find elements; once more than half of the elements are stale the
+     * whole forest is rebuilt.
+     *
+     * The tracker must not outlive the graph.
+     */
+    template<typename T>
+    class connectivity_tracker : public graph_observer<T> {
+    public:
+        /**
+         * @brief Computes the components of a graph and attaches to it.
+         */
+        explicit connectivity_tracker(undirected_graph<T>& graph) : m_graph(graph) {
+            this->rebuild();
+            this->m_graph.add_observer(this);
+        }
+
+        ~connectivity_tracker() override {
+            this->m_graph.remove_observer(this);
+        }
+
+        connectivity_tracker(const connectivity_tracker&) = delete;
+        connectivity_tracker& operator=(const connectivity_tracker&) = delete;
+
+        /**
+         * @brief Checks if two vertices are in the same connected component.
+         *
+         * @return True if there is a path between `u` and `v`, false otherwise or if either vertex is not in the graph.
+         */
+        bool connected(const T& u, const T& v) {
+            auto iu = this->m_id.find(u);
+            auto iv = this->m_id.find(v);
+            if (iu == this->m_id.end() || iv == this->m_id.end())
+                return false;
+
+            const size_t root = this->m_sets.find(iu->second);
+            // Removals only split components, so different sets stay disconnected
+            if (root != this->m_sets.find(iv->second))
+                return false;
+            if (!this->m_dirty[root])
+                return true;
+
+            this->refresh(root);
+            return this->m_sets.find(this->m_id.at(u)) == this->m_sets.find(this->m_id.at(v));
+        }
+
+        /**
+         * @brief Returns the number of connected components, rebuilding every dirty component first.
+         */
+        size_t component_count() {
+            std::vector<size_t> dirty;
+            dirty.swap(this->m_dirty_roots);
+            for (size_t element : dirty) {
+                // A full rebuild on the way renumbers everything and leaves nothing dirty
+                if (element >= this->m_sets.size())
+                    continue;
+
+                const size_t root = this->m_sets.find(element);
+                if (this->m_dirty[root])
+                    this->refresh(root);
+            }
+
+            return this->m_components;
+        }
+
+        void vertex_added(const T& v) override {
+            this->add(v);
+        }
+
+        void edge_added(const T& u, const T& v) override {
+            this->join(this->m_id.at(u), this->m_id.at(v));
+        }
+
+        void vertex_removed(const T& v) override {
+            auto it = this->m_id.find(v);
+            this->mark_dirty(it->second);
+            this->m_live[it->second] = false;
+            this->m_id.erase(it);
+        }
+
+        void edge_removed(const T& u, const T& v) override {
+            (void)v;
+            this->mark_dirty(this->m_id.at(u));
+        }
+
+        void cleared() override {
+            this->rebuild();
+        }
+
+    private:
+        size_t add(const T& v) {
+            const size_t element = this->m_sets.add();
+            this->m_id[v] = element;
+            this->m_vertex.push_back(v);
+            this->m_live.push_back(true);
+            this->m_dirty.push_back(false);
+            this->m_members.push_back({ element });
+            ++this->m_components;
+            return element;
+        }
+
+        void join(size_t a, size_t b) {
+            const size_t ra = this->m_sets.find(a);
+            const size_t rb = this->m_sets.find(b);
+            if (!this->m_sets.unite(ra, rb))
+                return;
+
+            const size_t root = this->m_sets.find(ra);
+            const size_t other = root == ra ? rb : ra;
+            auto& members = this->m_members[root];
+            auto& merged = this->m_members[other];
+            members.insert(members.end(), merged.begin(), merged.end());
+            std::vector<size_t>().swap(merged);
+            this->m_dirty[root] = this->m_dirty[root] || this->m_dirty[other];
+            --this->m_components;
+        }
+
+        void mark_dirty(size_t element) {
+            const size_t root = this->m_sets.find(element);
+            if (!this->m_dirty[root]) {
+                this->m_dirty[root] = true;
+                this->m_dirty_roots.push_back(root);
+            }
+        }
+
+        void refresh(size_t root) {
+            if (2 * this->m_id.size() < this->m_sets.size() && this->m_sets.size() > 1024) {
+                this->rebuild();
+                return;
+            }
+
+            std::vector<size_t> members;
+            members.swap(this->m_members[root]);
+            this->m_dirty[root] = false;
+            --this->m_components;
+
+            // Fresh elements for the live members, then reconnect them through their current edges
+            std::vector<size_t> fresh;
+            fresh.reserve(members.size());
+            for (size_t element : members) {
+                if (this->m_live[element]) {
+                    this->m_live[element] = false;
+                    fresh.push_back(this->add(this->m_vertex[element]));
+                }
+            }
+            for (size_t element : fresh) {
+                for (const T& neighbor : this->m_graph.neighbors(this->m_vertex[element])) {
+                    this->join(element, this->m_id.at(neighbor));
+                }
+            }
+        }
+
+        void rebuild() {
+            this->m_sets.reset(0);
+            this->m_id.clear();
+            this->m_vertex.clear();
+            this->m_live.clear();
+            this->m_dirty.clear();
+            this->m_members.clear();
+            this->m_dirty_roots.clear();
+            this->m_components = 0;
+
+            const csr_graph<T> topology(this->m_graph);
+            for (const T& v : topology.vertices()) {
+                this->add(v);
+            }
+            for (size_t u = 0; u < topology.size(); ++u) {
+                for (const size_t* it = topology.row_begin(u); it != topology.row_end(u); ++it) {
+                    if (u < *it)
+                        this->join(u, *it);
+                }
+            }
+        }
+
+        undirected_graph<T>& m_graph;
+        internal::union_find m_sets;
+        std::unordered_map<T, size_t> m_id;
+        std::vector<T> m_vertex;
+        std::vector<bool> m_live;
+        std::vector<bool> m_dirty;
+        std::vector<std::vector<size_t>> m_members;
+        std::vector<size_t> m_dirty_roots;
+        size_t m_components{ 0 };
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Core number of every vertex with the Batagelj-Zaversnik bucket algorithm in O(V + E).
+     *
+     * The core number of a vertex is the largest `k` such that the vertex belongs to a subgraph in
+     * which every vertex has degree at least `k`. The degree of a vertex is the length of its row,
+     * so the graph should store both directions of every edge, e.g. a `csr_graph` built from an
+     * `undirected_graph`.
+     *
+     * @param graph The graph.
+     * @return The core number of every vertex, indexed by dense id.
+     */
+    template<typename T>
+    std::vector<size_t> core_numbers(const csr_graph<T>& graph) {
+        const size_t n = graph.size();
+        std::vector<size_t> degree(n);
+        size_t max_degree{ 0 };
+        for (size_t v = 0; v < n; ++v) {
+            degree[v] = graph.row_size(v);
+            max_degree = std::max(max_degree, degree[v]);
+        }
+
+        // Vertices sorted by degree with a counting sort; bin[d] is the first position of degree d
+        std::vector<size_t> bin(max_degree + 1, 0);
+        for (size_t v = 0; v < n; ++v) {
+            ++bin[degree[v]];
+        }
+        size_t start{ 0 };
+        for (size_t d = 0; d <= max_degree; ++d) {
+            const size_t count = bin[d];
+            bin[d] = start;
+            start += count;
+        }
+
+        std::vector<size_t> position(n);
+        std::vector<size_t> order(n);
+        for (size_t v = 0; v < n; ++v) {
+            position[v] = bin[degree[v]]++;
+            order[position[v]] = v;
+        }
+        for (size_t d = max_degree; d > 0; --d) {
+            bin[d] = bin[d - 1];
+        }
+        if (!bin.empty())
+            bin[0] = 0;
+
+        for (size_t i = 0; i < n; ++i) {
+            const size_t v = order[i];
+            for (const size_t* it = graph.row_begin(v); it != graph.row_end(v); ++it) {
+                const size_t u = *it;
+                if (degree[u] <= degree[v])
+                    continue;
+
+                // Move u to the front of its bucket, then shrink the bucket past it
+                const size_t du = degree[u];
+                const size_t pu = position[u];
+                const size_t pw = bin[du];
+                const size_t w = order[pw];
+                if (u != w) {
+                    position[u] = pw;
+                    order[pu] = w;
+                    position[w] = pu;
+                    order[pw] = u;
+                }
+                ++bin[du];
+                --degree[u];
+            }
+        }
+
+        return degree;
+    }
+
+    /**
+     * @brief Core number of every vertex by parallel level-synchronous peeling.
+     *
+     * For every level `k` the vertices of degree at most `k` are removed in rounds; the workers
+     * of a round decrement the degrees of their neighbors atomically and collect the vertices
+     * that drop to `k` for the next round. Gives the same result as `core_numbers`.
+     *
+     * @param graph The graph; see `core_numbers`.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @return The core number of every vertex, indexed by dense id.
+     */
+    template<typename T>
+    std::vector<size_t> parallel_core_numbers(const csr_graph<T>& graph, size_t threads = 0) {
+        const size_t n = graph.size();
+        std::vector<std::atomic<size_t>> degree(n);
+        std::vector<size_t> core(n, 0);
+        std::vector<bool> removed(n, false);
+        size_t remaining = n;
+        for (size_t v = 0; v < n; ++v) {
+            degree[v].store(graph.row_size(v), std::memory_order_relaxed);
+        }
+
+        std::vector<size_t> frontier;
+        std::vector<std::vector<size_t>> next(internal::worker_count(threads, n));
+        size_t k{ 0 };
+        while (remaining > 0) {
+            // Jump to the smallest degree left instead of scanning empty levels
+            size_t smallest = std::numeric_limits<size_t>::max();
+            frontier.clear();
+            for (size_t v = 0; v < n; ++v) {
+                if (!removed[v])
+                    smallest = std::min(smallest, degree[v].load(std::memory_order_relaxed));
+            }
+            k = std::max(k, smallest);
+            for (size_t v = 0; v < n; ++v) {
+                if (!removed[v] && degree[v].load(std::memory_order_relaxed) <= k)
+                    frontier.push_back(v);
+            }
+
+            while (!frontier.empty()) {
+                for (size_t v : frontier) {
+                    removed[v] = true;
+                    core[v] = k;
+                }
+                remaining -= frontier.size();
+
+                const size_t workers = internal::parallel_for(frontier.size(), threads, [&](size_t worker, size_t begin, size_t end) {
+                    auto& found = next[worker];
+                    found.clear();
+                    for (size_t i = begin; i < end; ++i) {
+                        const size_t v = frontier[i];
+                        for (const size_t* it = graph.row_begin(v); it != graph.row_end(v); ++it) {
+                            auto& du = degree[*it];
+                            if (du.load(std::memory_order_relaxed) <= k)
+                                continue;
+
+                            const size_t previous = du.fetch_sub(1, std::memory_order_relaxed);
+                            if (previous == k + 1) {
+                                found.push_back(*it);
+                            }
+                            else if (previous <= k) {
+                                // Another worker got there first; never go below the level
+                                du.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                });
+
+                frontier.clear();
+                for (size_t worker = 0; worker < workers; ++worker) {
+                    frontier.insert(frontier.end(), next[worker].begin(), next[worker].end());
+                }
+            }
+        }
+
+        return core;
+    }
+
+    /**
+     * @brief Extracts the `k`-core, the largest subgraph in which every vertex has degree at least `k`.
+     *
+     * @param graph The graph; see `core_numbers`. It is not modified.
+     * @param k The minimum degree.
+     * @return The induced subgraph on the vertices with a core number of at least `k`.
+     */
+    template<typename T>
+    csr_graph<T> k_core(const csr_graph<T>& graph, size_t k) {
+        const std::vector<size_t> core = core_numbers(graph);
+        std::vector<T> vertices;
+        for (size_t id = 0; id < graph.size(); ++id) {
+            if (core[id] >= k)
+                vertices.push_back(graph.vertex_at(id));
+        }
+
+        return graph.induced_subgraph(vertices);
+    }
+
+    /**
+     * @brief Core number of every vertex of an undirected graph.
+     *
+     * @see core_numbers(const csr_graph<T>&)
+     * @return The core number of every vertex.
+     */
+    template<typename T>
+    std::unordered_map<T, size_t> core_numbers(const undirected_graph<T>& graph) {
+        const csr_graph<T> csr(graph);
+        const std::vector<size_t> core = core_numbers(csr);
+
+        std::unordered_map<T, size_t> numbers;
+        for (size_t id = 0; id < csr.size(); ++id) {
+            numbers.emplace(csr.vertex_at(id), core[id]);
+        }
+
+        return numbers;
+    }
+
+    /**
+     * @brief Extracts the `k`-core of an undirected graph without modifying it.
+     *
+     * @see k_core(const csr_graph<T>&, size_t)
+     */
+    template<typename T>
+    csr_graph<T> k_core(const undirected_graph<T>& graph, size_t k) {
+        return k_core(csr_graph<T>(graph), k);
+    }
+
+} // end of namespace grphx
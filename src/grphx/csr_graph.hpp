@@ -0,0 +1,658 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <queue>
+#include <stack>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "grphx.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Immutable compressed sparse row (CSR) representation of a graph.
+     *
+     * Every vertex is assigned a dense id in the range [0, size()) in the order in which it
+     * appears in the source graph. The neighbors of a vertex are stored contiguously and sorted
+     * by id, which makes iteration cache friendly and lets `contains_edge` use a binary search.
+     *
+     * An undirected graph is stored with both directions of every edge.
+     */
+    template<typename T>
+    class csr_graph {
+    public:
+        using vertex_id = std::size_t;
+        using edge_id = std::size_t;
+
+        static constexpr vertex_id npos = std::numeric_limits<vertex_id>::max();
+
+        csr_graph() : m_offsets(1, 0) {}
+
+        /**
+         * @brief Builds a CSR snapshot of a directed graph.
+         *
+         * @param graph The graph to copy.
+         */
+        explicit csr_graph(const directed_graph<T>& graph) : m_directed(true) {
+            build(graph);
+        }
+
+        /**
+         * @brief Builds a CSR snapshot of an undirected graph.
+         *
+         * @param graph The graph to copy.
+         */
+        explicit csr_graph(const undirected_graph<T>& graph) : m_directed(false) {
+            build(graph);
+        }
+
+        /**
+         * @brief Builds a CSR graph from a vertex list and an edge list.
+         *
+         * Endpoints of edges that are not part of `vertices` are added to the graph.
+         *
+         * @param vertices The vertices of the graph, in the order of their dense ids.
+         * @param edges The edges of the graph.
+         * @param directed Whether the edges are directed. Undirected edges are stored in both directions.
+         */
+        csr_graph(const std::vector<T>& vertices, const std::vector<std::pair<T, T>>& edges, bool directed = true)
+            : m_directed(directed) {
+            for (const auto& v : vertices) {
+                intern(v);
+            }
+
+            std::vector<std::pair<vertex_id, vertex_id>> arcs;
+            arcs.reserve(directed ? edges.size() : 2 * edges.size());
+            for (const auto& edge : edges) {
+                const vertex_id u = intern(edge.first);
+                const vertex_id v = intern(edge.second);
+                arcs.emplace_back(u, v);
+                if (!directed && u != v) {
+                    arcs.emplace_back(v, u);
+                }
+            }
+
+            assemble(arcs);
+        }
+
+        /**
+         * @brief Builds a weighted CSR graph from a vertex list and a weighted edge list.
+         *
+         * Endpoints of edges that are not part of `vertices` are added to the graph.
+         *
+         * @param vertices The vertices of the graph, in the order of their dense ids.
+         * @param edges The edges of the graph as (source, target, weight).
+         * @param directed Whether the edges are directed. Undirected edges are stored in both directions.
+         */
+        csr_graph(const std::vector<T>& vertices, const std::vector<std::tuple<T, T, double>>& edges, bool directed = true)
+            : m_directed(directed) {
+            for (const auto& v : vertices) {
+                intern(v);
+            }
+
+            std::vector<std::pair<vertex_id, vertex_id>> arcs;
+            std::vector<double> weights;
+            arcs.reserve(directed ? edges.size() : 2 * edges.size());
+            weights.reserve(arcs.capacity());
+            for (const auto& edge : edges) {
+                const vertex_id u = intern(std::get<0>(edge));
+                const vertex_id v = intern(std::get<1>(edge));
+                arcs.emplace_back(u, v);
+                weights.push_back(std::get<2>(edge));
+                if (!directed && u != v) {
+                    arcs.emplace_back(v, u);
+                    weights.push_back(std::get<2>(edge));
+                }
+            }
+
+            assemble(arcs, weights);
+        }
+
+        /**
+         * @brief Returns the number of vertices in the graph.
+         */
+        size_t size() const {
+            return this->m_vertices.size();
+        }
+
+        /**
+         * @brief Returns the number of stored edges (undirected edges count twice).
+         */
+        size_t edge_count() const {
+            return this->m_targets.size();
+        }
+
+        /**
+         * @brief Checks if the graph is empty.
+         */
+        bool is_empty() const {
+            return this->m_vertices.empty();
+        }
+
+        /**
+         * @brief Checks if the graph was built from directed edges.
+         */
+        bool is_directed() const {
+            return this->m_directed;
+        }
+
+        /**
+         * @brief Checks if the edges carry weights.
+         */
+        bool is_weighted() const {
+            return !this->m_weights.empty();
+        }
+
+        /**
+         * @brief Returns the weight of the edge stored at `targets()[edge]`, 1 for unweighted graphs.
+         */
+        double weight(edge_id edge) const {
+            return this->m_weights.empty() ? 1.0 : this->m_weights[edge];
+        }
+
+        /**
+         * @brief Returns the dense id of a vertex, or `npos` if the vertex is not in the graph.
+         */
+        vertex_id id_of(const T& v) const {
+            auto it = this->m_index.find(v);
+            return it != this->m_index.end() ? it->second : npos;
+        }
+
+        /**
+         * @brief Returns the vertex with the given dense id.
+         */
+        const T& vertex_at(vertex_id id) const {
+            return this->m_vertices[id];
+        }
+
+        /**
+         * @brief Returns all vertices, indexed by dense id.
+         */
+        const std::vector<T>& vertices() const {
+            return this->m_vertices;
+        }
+
+        /**
+         * @brief Returns the row offsets; the neighbors of `id` are `targets()[offsets()[id]..offsets()[id + 1])`.
+         */
+        const std::vector<edge_id>& offsets() const {
+            return this->m_offsets;
+        }
+
+        /**
+         * @brief Returns the concatenated, per-row sorted neighbor ids.
+         */
+        const std::vector<vertex_id>& targets() const {
+            return this->m_targets;
+        }
+
+        /**
+         * @brief Returns a pointer to the first neighbor id of a vertex.
+         */
+        const vertex_id* row_begin(vertex_id id) const {
+            return this->m_targets.data() + this->m_offsets[id];
+        }
+
+        /**
+         * @brief Returns a pointer past the last neighbor id of a vertex.
+         */
+        const vertex_id* row_end(vertex_id id) const {
+            return this->m_targets.data() + this->m_offsets[id + 1];
+        }
+
+        /**
+         * @brief Returns the number of neighbors stored for a dense id.
+         */
+        size_t row_size(vertex_id id) const {
+            return this->m_offsets[id + 1] - this->m_offsets[id];
+        }
+
+        /**
+         * @brief Checks if the graph contains a vertex.
+         */
+        bool contains_vertex(T v) const {
+            return this->id_of(v) != npos;
+        }
+
+        /**
+         * @brief Checks if the graph contains an edge from vertex `u` to vertex `v`.
+         */
+        bool contains_edge(T u, T v) const {
+            const vertex_id iu = this->id_of(u);
+            const vertex_id iv = this->id_of(v);
+            if (iu == npos || iv == npos)
+                return false;
+
+            return this->contains_edge_id(iu, iv);
+        }
+
+        /**
+         * @brief Checks if the graph contains an edge between two dense ids.
+         */
+        bool contains_edge_id(vertex_id u, vertex_id v) const {
+            return std::binary_search(this->row_begin(u), this->row_end(u), v);
+        }
+
+        /**
+         * @brief Returns the edge id of the edge between two dense ids, or `npos` if there is no such edge.
+         */
+        edge_id find_edge(vertex_id u, vertex_id v) const {
+            const vertex_id* it = std::lower_bound(this->row_begin(u), this->row_end(u), v);
+            return it != this->row_end(u) && *it == v ? static_cast<edge_id>(it - this->m_targets.data()) : npos;
+        }
+
+        /**
+         * @brief Returns the number of neighbors of a vertex, or 0 if the vertex is not in the graph.
+         */
+        size_t out_degree(T v) const {
+            const vertex_id id = this->id_of(v);
+            return id != npos ? this->row_size(id) : 0;
+        }
+
+        /**
+         * @brief Returns the list of successors of a vertex.
+         */
+        std::list<T> successors(T v) const {
+            std::list<T> successors;
+            const vertex_id id = this->id_of(v);
+            if (id == npos)
+                return successors;
+
+            for (const vertex_id* it = this->row_begin(id); it != this->row_end(id); ++it) {
+                successors.push_back(this->m_vertices[*it]);
+            }
+
+            return successors;
+        }
+
+        /**
+         * @brief Estimates the memory used by the graph.
+         *
+         * @return The estimated heap and object footprint, broken down by purpose.
+         */
+        memory_breakdown memory_usage() const {
+            memory_breakdown usage;
+            usage.vertex_table = this->m_vertices.size() * sizeof(T);
+            usage.adjacency = this->m_offsets.size() * sizeof(edge_id) + this->m_targets.size() * sizeof(vertex_id)
+                + this->m_weights.size() * sizeof(double);
+            usage.indexes = internal::hash_table_size(this->m_index.bucket_count(), this->m_index.size(), sizeof(std::pair<const T, vertex_id>));
+            usage.overhead = sizeof(*this)
+                + (this->m_vertices.capacity() - this->m_vertices.size()) * sizeof(T)
+                + (this->m_offsets.capacity() - this->m_offsets.size()) * sizeof(edge_id)
+                + (this->m_targets.capacity() - this->m_targets.size()) * sizeof(vertex_id)
+                + (this->m_weights.capacity() - this->m_weights.size()) * sizeof(double);
+
+            return usage;
+        }
+
+        /**
+         * @brief Releases unused capacity of all arrays and shrinks the vertex index to its size.
+         */
+        void shrink_to_fit() {
+            this->m_vertices.shrink_to_fit();
+            this->m_offsets.shrink_to_fit();
+            this->m_targets.shrink_to_fit();
+            this->m_weights.shrink_to_fit();
+            this->m_index.rehash(0);
+        }
+
+        /**
+         * @brief Relabels the dense vertex ids to improve memory locality of traversals.
+         *
+         * Vertices keep their values; only their dense ids and the layout of the rows change.
+         *
+         * @param strategy The ordering strategy.
+         */
+        void reorder(vertex_ordering strategy) {
+            const std::vector<vertex_id> order = internal::compute_ordering(this->m_offsets, this->m_targets, strategy);
+            std::vector<vertex_id> rank(order.size());
+            for (vertex_id i = 0; i < order.size(); ++i) {
+                rank[order[i]] = i;
+            }
+
+            std::vector<T> vertices;
+            std::vector<edge_id> offsets{ 0 };
+            std::vector<vertex_id> targets;
+            std::vector<double> weights;
+            vertices.reserve(this->m_vertices.size());
+            offsets.reserve(this->m_offsets.size());
+            targets.reserve(this->m_targets.size());
+            weights.reserve(this->m_weights.size());
+
+            for (vertex_id old_id : order) {
+                vertices.push_back(std::move(this->m_vertices[old_id]));
+                for (edge_id e = this->m_offsets[old_id]; e < this->m_offsets[old_id + 1]; ++e) {
+                    targets.push_back(rank[this->m_targets[e]]);
+                    if (this->is_weighted())
+                        weights.push_back(this->m_weights[e]);
+                }
+                offsets.push_back(targets.size());
+            }
+
+            for (auto& entry : this->m_index) {
+                entry.second = rank[entry.second];
+            }
+
+            this->m_vertices.swap(vertices);
+            this->m_offsets.swap(offsets);
+            this->m_targets.swap(targets);
+            this->m_weights.swap(weights);
+            this->sort_rows();
+        }
+
+        /**
+         * @brief Breadth-First Search (BFS) algorithm.
+         *
+         * @param start The starting vertex for BFS traversal.
+         * @return A vector containing the vertices visited during BFS traversal.
+         */
+        std::vector<T> bfs(T start) const {
+            std::vector<T> visited;
+            const vertex_id source = this->id_of(start);
+            if (source == npos)
+                return visited;
+
+            std::vector<bool> seen(this->size(), false);
+            std::queue<vertex_id> queue;
+            queue.push(source);
+            seen[source] = true;
+
+            while (!queue.empty()) {
+                const vertex_id current = queue.front();
+                queue.pop();
+                visited.push_back(this->m_vertices[current]);
+
+                for (const vertex_id* it = this->row_begin(current); it != this->row_end(current); ++it) {
+                    if (!seen[*it]) {
+                        seen[*it] = true;
+                        queue.push(*it);
+                    }
+                }
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Depth-First Search (DFS) algorithm.
+         *
+         * @param start The starting vertex for DFS traversal.
+         * @return A vector containing the vertices visited during DFS traversal.
+         */
+        std::vector<T> dfs(T start) const {
+            std::vector<T> visited;
+            const vertex_id source = this->id_of(start);
+            if (source == npos)
+                return visited;
+
+            std::vector<bool> seen(this->size(), false);
+            std::stack<vertex_id> stack;
+            stack.push(source);
+
+            while (!stack.empty()) {
+                const vertex_id current = stack.top();
+                stack.pop();
+
+                if (!seen[current]) {
+                    seen[current] = true;
+                    visited.push_back(this->m_vertices[current]);
+
+                    for (const vertex_id* it = this->row_begin(current); it != this->row_end(current); ++it) {
+                        if (!seen[*it]) {
+                            stack.push(*it);
+                        }
+                    }
+                }
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Extracts the subgraph induced by a set of vertices.
+         *
+         * The new graph holds the given vertices, relabeled to dense ids in the order they are
+         * listed, and every edge of this graph between two of them. Vertices that are not in this
+         * graph and repeated vertices are skipped.
+         *
+         * @param vertices The vertices to keep.
+         * @return The induced subgraph.
+         */
+        csr_graph induced_subgraph(const std::vector<T>& vertices) const {
+            std::vector<vertex_id> ids;
+            ids.reserve(vertices.size());
+            for (const auto& v : vertices) {
+                const vertex_id id = this->id_of(v);
+                if (id != npos)
+                    ids.push_back(id);
+            }
+
+            return this->subgraph(ids);
+        }
+
+        /**
+         * @brief Extracts the subgraph induced by all vertices within `k` hops of a set of seeds.
+         *
+         * Every seed is expanded on its own, the seeds are spread over `threads` workers and the
+         * results are merged. When `fanout` limits a hop, a vertex with more out-neighbors only
+         * expands a random sample of that many of them. The sample is drawn from `seed`, the vertex
+         * and the hop, so the result does not depend on the number of threads.
+         *
+         * The seeds get the first dense ids of the new graph in the order given; the other vertices
+         * follow by hop distance and then by their dense id in this graph.
+         *
+         * @param seeds The vertices to start from; vertices not in the graph are skipped.
+         * @param k The number of hops.
+         * @param fanout The maximum number of neighbors expanded per vertex at hop `i`, 0 or missing for no limit.
+         * @param threads The number of threads; 0 selects the hardware concurrency.
+         * @param seed The seed of the neighbor sampling.
+         * @return The induced subgraph of the neighborhood.
+         */
+        csr_graph k_hop_neighborhood(const std::vector<T>& seeds, size_t k, const std::vector<size_t>& fanout = {},
+                                     size_t threads = 0, std::uint64_t seed = 0) const {
+            std::vector<vertex_id> sources;
+            std::unordered_set<vertex_id> unique;
+            for (const auto& v : seeds) {
+                const vertex_id id = this->id_of(v);
+                if (id != npos && unique.insert(id).second)
+                    sources.push_back(id);
+            }
+
+            std::vector<std::unordered_map<vertex_id, size_t>> found(internal::worker_count(threads, sources.size()));
+            internal::parallel_for(sources.size(), threads, [&](size_t worker, size_t begin, size_t end) {
+                auto& hops = found[worker];
+                std::unordered_set<vertex_id> seen;
+                std::vector<vertex_id> frontier;
+                std::vector<vertex_id> next;
+                std::vector<vertex_id> sample;
+
+                for (size_t i = begin; i < end; ++i) {
+                    seen.clear();
+                    seen.insert(sources[i]);
+                    frontier.assign(1, sources[i]);
+                    hops[sources[i]] = 0;
+
+                    for (size_t hop = 0; hop < k && !frontier.empty(); ++hop) {
+                        const size_t limit = hop < fanout.size() ? fanout[hop] : 0;
+                        next.clear();
+                        for (vertex_id current : frontier) {
+                            this->sample_row(current, hop, limit, seed, sample);
+                            for (vertex_id neighbor : sample) {
+                                if (!seen.insert(neighbor).second)
+                                    continue;
+
+                                next.push_back(neighbor);
+                                auto entry = hops.emplace(neighbor, hop + 1);
+                                if (!entry.second && hop + 1 < entry.first->second)
+                                    entry.first->second = hop + 1;
+                            }
+                        }
+                        frontier.swap(next);
+                    }
+                }
+            });
+
+            std::unordered_map<vertex_id, size_t> merged;
+            for (const auto& hops : found) {
+                for (const auto& entry : hops) {
+                    auto it = merged.emplace(entry.first, entry.second);
+                    if (!it.second && entry.second < it.first->second)
+                        it.first->second = entry.second;
+                }
+            }
+
+            std::vector<std::pair<size_t, vertex_id>> reached;
+            for (const auto& entry : merged) {
+                if (entry.second > 0)
+                    reached.emplace_back(entry.second, entry.first);
+            }
+            std::sort(reached.begin(), reached.end());
+            for (const auto& entry : reached) {
+                sources.push_back(entry.second);
+            }
+
+            return this->subgraph(sources);
+        }
+
+    private:
+        csr_graph subgraph(const std::vector<vertex_id>& ids) const {
+            csr_graph result;
+            result.m_directed = this->m_directed;
+
+            std::unordered_map<vertex_id, vertex_id> relabel;
+            std::vector<vertex_id> kept;
+            relabel.reserve(ids.size());
+            for (vertex_id id : ids) {
+                if (relabel.emplace(id, kept.size()).second) {
+                    kept.push_back(id);
+                    result.intern(this->m_vertices[id]);
+                }
+            }
+
+            for (vertex_id old_id : kept) {
+                for (edge_id e = this->m_offsets[old_id]; e < this->m_offsets[old_id + 1]; ++e) {
+                    auto it = relabel.find(this->m_targets[e]);
+                    if (it == relabel.end())
+                        continue;
+
+                    result.m_targets.push_back(it->second);
+                    if (this->is_weighted())
+                        result.m_weights.push_back(this->m_weights[e]);
+                }
+                result.m_offsets.push_back(result.m_targets.size());
+            }
+
+            result.sort_rows();
+            return result;
+        }
+
+        void sample_row(vertex_id id, size_t hop, size_t limit, std::uint64_t seed, std::vector<vertex_id>& sample) const {
+            const vertex_id* begin = this->row_begin(id);
+            const size_t degree = this->row_size(id);
+            if (limit == 0 || degree <= limit) {
+                sample.assign(begin, begin + degree);
+                return;
+            }
+
+            // Floyd's algorithm: `limit` distinct positions in O(limit^2) without touching the whole row
+            const std::uint64_t stream = internal::mix64(seed ^ internal::mix64(id)) + hop;
+            sample.clear();
+            for (size_t j = degree - limit; j < degree; ++j) {
+                const size_t position = static_cast<size_t>(internal::mix64(stream + j) % (j + 1));
+                sample.push_back(std::find(sample.begin(), sample.end(), position) == sample.end() ? position : j);
+            }
+            for (auto& position : sample) {
+                position = begin[position];
+            }
+        }
+
+        void build(const internal::basic_graph<T>& graph) {
+            for (const auto& pair : graph.m_adjacency_list) {
+                intern(pair.first);
+            }
+
+            // Entries tombstoned by lazy removal are not part of the snapshot
+            std::vector<std::pair<vertex_id, vertex_id>> arcs;
+            for (const auto& pair : graph.m_adjacency_list) {
+                const vertex_id u = this->m_index.at(pair.first);
+                for (const auto& neighbor : pair.second) {
+                    if (graph.is_live(pair.first, neighbor))
+                        arcs.emplace_back(u, intern(neighbor));
+                }
+            }
+
+            assemble(arcs);
+        }
+
+        vertex_id intern(const T& v) {
+            auto result = this->m_index.emplace(v, this->m_vertices.size());
+            if (result.second) {
+                this->m_vertices.push_back(v);
+            }
+
+            return result.first->second;
+        }
+
+        void assemble(const std::vector<std::pair<vertex_id, vertex_id>>& arcs, const std::vector<double>& weights = {}) {
+            // Counting sort of the arcs by source id
+            this->m_offsets.assign(this->m_vertices.size() + 1, 0);
+            for (const auto& arc : arcs) {
+                ++this->m_offsets[arc.first + 1];
+            }
+            for (size_t i = 1; i < this->m_offsets.size(); ++i) {
+                this->m_offsets[i] += this->m_offsets[i - 1];
+            }
+
+            this->m_targets.resize(arcs.size());
+            this->m_weights.resize(weights.size());
+            std::vector<edge_id> cursor(this->m_offsets.begin(), this->m_offsets.end() - 1);
+            for (size_t i = 0; i < arcs.size(); ++i) {
+                const edge_id slot = cursor[arcs[i].first]++;
+                this->m_targets[slot] = arcs[i].second;
+                if (!weights.empty())
+                    this->m_weights[slot] = weights[i];
+            }
+
+            this->sort_rows();
+        }
+
+        void sort_rows() {
+            std::vector<std::pair<vertex_id, double>> row;
+            for (vertex_id id = 0; id < this->m_vertices.size(); ++id) {
+                const auto begin = this->m_targets.begin() + this->m_offsets[id];
+                const auto end = this->m_targets.begin() + this->m_offsets[id + 1];
+                if (!this->is_weighted()) {
+                    std::sort(begin, end);
+                    continue;
+                }
+
+                row.clear();
+                for (edge_id e = this->m_offsets[id]; e < this->m_offsets[id + 1]; ++e) {
+                    row.emplace_back(this->m_targets[e], this->m_weights[e]);
+                }
+                std::sort(row.begin(), row.end());
+                for (size_t i = 0; i < row.size(); ++i) {
+                    this->m_targets[this->m_offsets[id] + i] = row[i].first;
+                    this->m_weights[this->m_offsets[id] + i] = row[i].second;
+                }
+            }
+        }
+
+        bool m_directed{ true };
+        std::vector<T> m_vertices;
+        std::unordered_map<T, vertex_id> m_index;
+        std::vector<edge_id> m_offsets;
+        std::vector<vertex_id> m_targets;
+        std::vector<double> m_weights;
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,500 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "properties.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Dynamic directed graph made of an immutable CSR base and an append-only delta.
+     *
+     * Insertions are appended to a per-vertex delta and deletions of base edges and vertices are
+     * recorded as tombstones, so updates never touch the base. Tombstones are bits indexed by edge
+     * and vertex id: removing a vertex is O(1) and removing a base edge costs one binary search in
+     * its row. Reads merge the base with the delta on the fly and skip dead entries. `compact()`
+     * folds the delta into a new base; it is also triggered automatically once the delta grows
+     * beyond the compaction threshold or the tombstones beyond the tombstone threshold.
+     */
+    template<typename T>
+    class delta_graph {
+    public:
+        using vertex_id = typename csr_graph<T>::vertex_id;
+        using edge_id = typename csr_graph<T>::edge_id;
+
+        static constexpr vertex_id npos = csr_graph<T>::npos;
+
+        delta_graph() = default;
+
+        /**
+         * @brief Creates a delta graph on top of an existing CSR base.
+         *
+         * @param base The base graph.
+         */
+        explicit delta_graph(csr_graph<T> base)
+            : m_base(std::move(base)), m_dead_edges(this->m_base.edge_count(), false), m_dead_vertices(this->m_base.size(), false) {}
+
+        /**
+         * @brief Creates a delta graph whose base is a snapshot of a directed graph.
+         *
+         * @param graph The graph to copy.
+         */
+        explicit delta_graph(const directed_graph<T>& graph) : delta_graph(csr_graph<T>(graph)) {}
+
+        /**
+         * @brief Adds a new vertex to the graph.
+         *
+         * If the vertex already exists in the graph, it will not be added again.
+         *
+         * @param v The vertex to add to the graph.
+         */
+        void add_vertex(T v) {
+            if (this->id_of(v) == npos) {
+                this->insert_vertex(v);
+                this->maybe_compact();
+            }
+        }
+
+        /**
+         * @brief Adds a new directed edge from vertex `u` to vertex `v` in the graph.
+         *
+         * If either of the vertices does not exist in the graph, it will be added. Adding an edge
+         * that already exists has no effect.
+         *
+         * @param u The source vertex of the directed edge.
+         * @param v The destination vertex of the directed edge.
+         */
+        void add_edge(T u, T v) {
+            vertex_id iu = this->id_of(u);
+            if (iu == npos)
+                iu = this->insert_vertex(u);
+
+            vertex_id iv = this->id_of(v);
+            if (iv == npos)
+                iv = this->insert_vertex(v);
+
+            if (this->contains_edge_id(iu, iv))
+                return;
+
+            const edge_id edge = this->base_edge(iu, iv);
+            if (edge != npos) {
+                // The edge lives in the base, lifting the tombstone restores it
+                this->m_dead_edges[edge] = false;
+                --this->m_dead_edge_count;
+            }
+            else {
+                this->m_inserted_edges[iu].push_back(iv);
+                ++this->m_inserted_count;
+            }
+
+            this->maybe_compact();
+        }
+
+        /**
+         * @brief Removes a vertex and all of its edges from the graph.
+         *
+         * If the vertex does not exist in the graph, this function has no effect.
+         *
+         * @param v The vertex to remove from the graph.
+         */
+        void remove_vertex(T v) {
+            const vertex_id id = this->id_of(v);
+            if (id == npos)
+                return;
+
+            auto inserted = this->m_inserted_edges.find(id);
+            if (inserted != this->m_inserted_edges.end()) {
+                this->m_inserted_count -= inserted->second.size();
+                this->m_inserted_edges.erase(inserted);
+            }
+
+            this->m_dead_vertices[id] = true;
+            ++this->m_dead_vertex_count;
+            for (auto& property : this->m_properties) {
+                property->reset(id);
+            }
+            this->m_delta_index.erase(v);
+            this->maybe_compact();
+        }
+
+        /**
+         * @brief Removes a directed edge from vertex `u` to vertex `v` in the graph.
+         *
+         * If the directed edge does not exist in the graph, this function has no effect.
+         *
+         * @param u The source vertex of the directed edge to remove.
+         * @param v The destination vertex of the directed edge to remove.
+         */
+        void remove_edge(T u, T v) {
+            const vertex_id iu = this->id_of(u);
+            const vertex_id iv = this->id_of(v);
+            if (iu == npos || iv == npos)
+                return;
+
+            auto inserted = this->m_inserted_edges.find(iu);
+            if (inserted != this->m_inserted_edges.end()) {
+                auto& row = inserted->second;
+                auto it = std::find(row.begin(), row.end(), iv);
+                if (it != row.end()) {
+                    row.erase(it);
+                    --this->m_inserted_count;
+                    return;
+                }
+            }
+
+            const edge_id edge = this->base_edge(iu, iv);
+            if (edge != npos && !this->m_dead_edges[edge]) {
+                this->m_dead_edges[edge] = true;
+                ++this->m_dead_edge_count;
+                this->maybe_compact();
+            }
+        }
+
+        /**
+         * @brief Checks if the graph contains a vertex.
+         */
+        bool contains_vertex(T v) const {
+            return this->id_of(v) != npos;
+        }
+
+        /**
+         * @brief Checks if the graph contains a directed edge from vertex `u` to vertex `v`.
+         */
+        bool contains_edge(T u, T v) const {
+            const vertex_id iu = this->id_of(u);
+            const vertex_id iv = this->id_of(v);
+            if (iu == npos || iv == npos)
+                return false;
+
+            return this->contains_edge_id(iu, iv);
+        }
+
+        /**
+         * @brief Returns the number of vertices in the graph.
+         */
+        size_t size() const {
+            return this->m_base.size() + this->m_delta_vertices.size() - this->m_dead_vertex_count;
+        }
+
+        /**
+         * @brief Checks if the graph is empty.
+         */
+        bool is_empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief Returns the out-degree of a vertex, or 0 if the vertex is not in the graph.
+         */
+        size_t out_degree(T v) const {
+            size_t count{ 0 };
+            const vertex_id id = this->id_of(v);
+            if (id != npos) {
+                this->for_each_successor(id, [&count](vertex_id) { ++count; });
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Returns the list of successors of a vertex, merging the base and the delta.
+         */
+        std::list<T> successors(T v) const {
+            std::list<T> successors;
+            const vertex_id id = this->id_of(v);
+            if (id != npos) {
+                this->for_each_successor(id, [this, &successors](vertex_id neighbor) {
+                    successors.push_back(this->key_of(neighbor));
+                });
+            }
+
+            return successors;
+        }
+
+        /**
+         * @brief Breadth-First Search (BFS) algorithm over the merged view.
+         *
+         * @param start The starting vertex for BFS traversal.
+         * @return A vector containing the vertices visited during BFS traversal.
+         */
+        std::vector<T> bfs(T start) const {
+            std::vector<T> visited;
+            const vertex_id source = this->id_of(start);
+            if (source == npos)
+                return visited;
+
+            std::vector<bool> seen(this->m_base.size() + this->m_delta_vertices.size(), false);
+            std::queue<vertex_id> queue;
+            queue.push(source);
+            seen[source] = true;
+
+            while (!queue.empty()) {
+                const vertex_id current = queue.front();
+                queue.pop();
+                visited.push_back(this->key_of(current));
+
+                this->for_each_successor(current, [&seen, &queue](vertex_id neighbor) {
+                    if (!seen[neighbor]) {
+                        seen[neighbor] = true;
+                        queue.push(neighbor);
+                    }
+                });
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Returns the number of pending updates (inserted vertices and edges plus tombstones).
+         */
+        size_t delta_size() const {
+            return this->m_delta_vertices.size() + this->m_inserted_count
+                + this->m_dead_edge_count + this->m_dead_vertex_count;
+        }
+
+        /**
+         * @brief Returns the number of tombstoned edges and vertices per stored base edge and vertex id.
+         */
+        double tombstone_ratio() const {
+            const size_t stored = this->m_base.edge_count() + this->m_dead_vertices.size();
+            if (stored == 0)
+                return 0.0;
+
+            return static_cast<double>(this->m_dead_edge_count + this->m_dead_vertex_count) / static_cast<double>(stored);
+        }
+
+        /**
+         * @brief Sets the ratio of pending updates to base edges that triggers an automatic compaction.
+         *
+         * @param ratio The compaction threshold; 0 disables automatic compaction.
+         */
+        void set_compaction_threshold(double ratio) {
+            this->m_compaction_threshold = ratio;
+        }
+
+        /**
+         * @brief Sets the tombstone ratio that triggers an automatic compaction.
+         *
+         * @param ratio The tombstone threshold; 0 disables compaction on tombstones.
+         */
+        void set_tombstone_threshold(double ratio) {
+            this->m_tombstone_threshold = ratio;
+        }
+
+        /**
+         * @brief Merges the delta into a new CSR base and clears all pending updates.
+         */
+        void compact() {
+            std::vector<T> vertices;
+            std::vector<std::pair<T, T>> edges;
+            vertices.reserve(this->size());
+
+            // The new base numbers the live vertices in id order, properties follow the same order
+            std::vector<vertex_id> live;
+            live.reserve(this->size());
+            for (vertex_id id = 0; id < this->id_count(); ++id) {
+                if (!this->is_live(id))
+                    continue;
+
+                live.push_back(id);
+                vertices.push_back(this->key_of(id));
+                this->for_each_successor(id, [this, id, &edges](vertex_id neighbor) {
+                    edges.emplace_back(this->key_of(id), this->key_of(neighbor));
+                });
+            }
+
+            this->m_base = csr_graph<T>(vertices, edges);
+            this->m_delta_vertices.clear();
+            this->m_delta_index.clear();
+            this->m_inserted_edges.clear();
+            this->m_dead_edges.assign(this->m_base.edge_count(), false);
+            this->m_dead_vertices.assign(this->m_base.size(), false);
+            this->m_dead_edge_count = 0;
+            this->m_dead_vertex_count = 0;
+            this->m_inserted_count = 0;
+            for (auto& property : this->m_properties) {
+                property->gather(live);
+            }
+        }
+
+        /**
+         * @brief Estimates the memory used by the base and the pending delta.
+         *
+         * @return The estimated heap and object footprint, broken down by purpose.
+         */
+        memory_breakdown memory_usage() const {
+            memory_breakdown usage = this->m_base.memory_usage();
+            usage.overhead += sizeof(*this) - sizeof(this->m_base);
+
+            usage.vertex_table += this->m_delta_vertices.size() * sizeof(T);
+            usage.overhead += (this->m_delta_vertices.capacity() - this->m_delta_vertices.size()) * sizeof(T);
+
+            usage.indexes += internal::hash_table_size(this->m_delta_index.bucket_count(), this->m_delta_index.size(), sizeof(std::pair<const T, vertex_id>))
+                + (this->m_dead_edges.size() + 7) / 8 + (this->m_dead_vertices.size() + 7) / 8;
+
+            usage.overhead += internal::hash_table_size(this->m_inserted_edges.bucket_count(), this->m_inserted_edges.size(), sizeof(std::pair<const vertex_id, std::vector<vertex_id>>));
+            for (const auto& row : this->m_inserted_edges) {
+                usage.adjacency += row.second.size() * sizeof(vertex_id);
+                usage.overhead += (row.second.capacity() - row.second.size()) * sizeof(vertex_id);
+            }
+
+            return usage;
+        }
+
+        /**
+         * @brief Compacts the delta into the base and releases all unused capacity.
+         */
+        void shrink_to_fit() {
+            this->compact();
+            this->m_base.shrink_to_fit();
+            this->m_delta_vertices.shrink_to_fit();
+            this->m_delta_index.rehash(0);
+            this->m_inserted_edges.rehash(0);
+            this->m_dead_edges.shrink_to_fit();
+            this->m_dead_vertices.shrink_to_fit();
+        }
+
+        /**
+         * @brief Returns the current CSR base.
+         */
+        const csr_graph<T>& base() const {
+            return this->m_base;
+        }
+
+        /**
+         * @brief Returns the dense id of a vertex, or `npos` if the vertex is not in the graph.
+         *
+         * Ids are stable until the next compaction, which renumbers the live vertices.
+         */
+        vertex_id id_of(const T& v) const {
+            auto it = this->m_delta_index.find(v);
+            if (it != this->m_delta_index.end())
+                return it->second;
+
+            const vertex_id id = this->m_base.id_of(v);
+            return id != npos && this->is_live(id) ? id : npos;
+        }
+
+        /**
+         * @brief Creates a vertex property that the graph keeps consistent with its vertex ids.
+         *
+         * The column grows with every inserted vertex, the entry of a removed vertex is reset to
+         * `initial` and compactions renumber the column together with the vertices, so
+         * `property[graph.id_of(v)]` always refers to `v`. The property lives as long as the graph.
+         *
+         * @param initial The value of existing and new entries.
+         * @return The property.
+         */
+        template<typename P>
+        vertex_property<P>& add_vertex_property(const P& initial = P()) {
+            auto property = std::make_unique<vertex_property<P>>(this->id_count(), initial);
+            vertex_property<P>& result = *property;
+            this->m_properties.push_back(std::move(property));
+            return result;
+        }
+
+    private:
+        static constexpr size_t minimum_compaction_size = 1024;
+
+        vertex_id id_count() const {
+            return this->m_base.size() + this->m_delta_vertices.size();
+        }
+
+        const T& key_of(vertex_id id) const {
+            return this->in_base(id) ? this->m_base.vertex_at(id) : this->m_delta_vertices[id - this->m_base.size()];
+        }
+
+        bool in_base(vertex_id id) const {
+            return id < this->m_base.size();
+        }
+
+        bool is_live(vertex_id id) const {
+            return !this->m_dead_vertices[id];
+        }
+
+        edge_id base_edge(vertex_id u, vertex_id v) const {
+            return this->in_base(u) && this->in_base(v) ? this->m_base.find_edge(u, v) : npos;
+        }
+
+        vertex_id insert_vertex(const T& v) {
+            // Removed vertices get a fresh id so that stale edges pointing at the old id stay dead
+            const vertex_id id = this->m_base.size() + this->m_delta_vertices.size();
+            this->m_delta_vertices.push_back(v);
+            this->m_delta_index[v] = id;
+            this->m_dead_vertices.push_back(false);
+            for (auto& property : this->m_properties) {
+                property->resize(id + 1);
+            }
+            return id;
+        }
+
+        bool contains_edge_id(vertex_id u, vertex_id v) const {
+            auto inserted = this->m_inserted_edges.find(u);
+            if (inserted != this->m_inserted_edges.end()
+                && std::find(inserted->second.begin(), inserted->second.end(), v) != inserted->second.end())
+                return true;
+
+            const edge_id edge = this->base_edge(u, v);
+            return edge != npos && !this->m_dead_edges[edge];
+        }
+
+        template<typename Function>
+        void for_each_successor(vertex_id id, Function&& function) const {
+            if (this->in_base(id)) {
+                const auto& targets = this->m_base.targets();
+                for (edge_id edge = this->m_base.offsets()[id]; edge < this->m_base.offsets()[id + 1]; ++edge) {
+                    if (!this->m_dead_edges[edge] && this->is_live(targets[edge])) {
+                        function(targets[edge]);
+                    }
+                }
+            }
+
+            auto inserted = this->m_inserted_edges.find(id);
+            if (inserted != this->m_inserted_edges.end()) {
+                for (const vertex_id neighbor : inserted->second) {
+                    if (this->is_live(neighbor)) {
+                        function(neighbor);
+                    }
+                }
+            }
+        }
+
+        void maybe_compact() {
+            const size_t base_edges = std::max(this->m_base.edge_count(), minimum_compaction_size);
+            if (this->m_compaction_threshold > 0.0
+                && static_cast<double>(this->delta_size()) > this->m_compaction_threshold * static_cast<double>(base_edges)) {
+                this->compact();
+                return;
+            }
+
+            const size_t stored = std::max(this->m_base.edge_count() + this->m_dead_vertices.size(), minimum_compaction_size);
+            const size_t tombstones = this->m_dead_edge_count + this->m_dead_vertex_count;
+            if (this->m_tombstone_threshold > 0.0
+                && static_cast<double>(tombstones) > this->m_tombstone_threshold * static_cast<double>(stored)) {
+                this->compact();
+            }
+        }
+
+        csr_graph<T> m_base;
+        std::vector<T> m_delta_vertices;
+        std::unordered_map<T, vertex_id> m_delta_index;
+        std::unordered_map<vertex_id, std::vector<vertex_id>> m_inserted_edges;
+        std::vector<bool> m_dead_edges;
+        std::vector<bool> m_dead_vertices;
+        size_t m_dead_edge_count{ 0 };
+        size_t m_dead_vertex_count{ 0 };
+        size_t m_inserted_count{ 0 };
+        double m_compaction_threshold{ 0.25 };
+        double m_tombstone_threshold{ 0.5 };
+        std::vector<std::unique_ptr<internal::property_column>> m_properties;
+    };
+
+} // end of namespace grphx
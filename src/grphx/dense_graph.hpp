@@ -0,0 +1,406 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bits.hpp"
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Graph stored as an adjacency bit matrix, for dense graphs.
+     *
+     * Every vertex owns a slot; row `i` of the matrix holds one bit per slot. `contains_edge` is
+     * a single bit test, degrees and common-neighbor counts are popcounts over contiguous words,
+     * and BFS expands a whole frontier by OR-ing rows. Directed graphs also keep the transposed
+     * matrix so that in-degrees and predecessors are row operations too.
+     *
+     * The matrix takes capacity² bits, which beats the list layout from roughly 1% density on.
+     * Removed vertices free their slot for reuse.
+     */
+    template<typename T>
+    class dense_graph {
+    public:
+        /**
+         * @brief Creates an empty graph.
+         *
+         * @param directed Whether edges are directed; undirected edges are stored in both directions.
+         */
+        explicit dense_graph(bool directed = true) : m_directed(directed) {}
+
+        /**
+         * @brief Creates a bit-matrix copy of a directed graph.
+         */
+        explicit dense_graph(const directed_graph<T>& graph) : dense_graph(csr_graph<T>(graph)) {}
+
+        /**
+         * @brief Creates a bit-matrix copy of an undirected graph.
+         */
+        explicit dense_graph(const undirected_graph<T>& graph) : dense_graph(csr_graph<T>(graph)) {}
+
+        /**
+         * @brief Creates a bit-matrix copy of a CSR graph.
+         */
+        explicit dense_graph(const csr_graph<T>& graph) : m_directed(graph.is_directed()) {
+            this->reserve(graph.size());
+            for (const auto& v : graph.vertices()) {
+                this->add_vertex(v);
+            }
+            for (size_t u = 0; u < graph.size(); ++u) {
+                for (const size_t* it = graph.row_begin(u); it != graph.row_end(u); ++it) {
+                    this->set(u, *it);
+                }
+            }
+        }
+
+        /**
+         * @brief Checks if edges are directed.
+         */
+        bool is_directed() const {
+            return this->m_directed;
+        }
+
+        /**
+         * @brief Returns the number of vertices in the graph.
+         */
+        size_t size() const {
+            return this->m_index.size();
+        }
+
+        /**
+         * @brief Checks if the graph is empty.
+         */
+        bool is_empty() const {
+            return this->m_index.empty();
+        }
+
+        /**
+         * @brief Grows the matrix so that `capacity` vertices fit without relayout.
+         */
+        void reserve(size_t capacity) {
+            if (capacity <= this->m_capacity)
+                return;
+
+            const size_t words = (capacity + 63) / 64;
+            this->m_rows = relayout(this->m_rows, this->m_capacity, this->m_words, capacity, words);
+            if (this->m_directed)
+                this->m_columns = relayout(this->m_columns, this->m_capacity, this->m_words, capacity, words);
+            this->m_capacity = capacity;
+            this->m_words = words;
+        }
+
+        /**
+         * @brief Adds a new vertex to the graph.
+         *
+         * If the vertex already exists in the graph, it will not be added again.
+         *
+         * @param v The vertex to add to the graph.
+         */
+        void add_vertex(T v) {
+            if (this->m_index.find(v) != this->m_index.end())
+                return;
+
+            size_t slot;
+            if (!this->m_free.empty()) {
+                slot = this->m_free.back();
+                this->m_free.pop_back();
+                this->m_vertices[slot] = v;
+            }
+            else {
+                slot = this->m_vertices.size();
+                if (slot == this->m_capacity)
+                    this->reserve(std::max<size_t>(64, 2 * this->m_capacity));
+                this->m_vertices.push_back(v);
+            }
+            this->m_index.emplace(std::move(v), slot);
+        }
+
+        /**
+         * @brief Adds a new edge from vertex `u` to vertex `v`.
+         *
+         * If either of the vertices does not exist in the graph, it will be added. Adding an edge
+         * that already exists has no effect.
+         */
+        void add_edge(T u, T v) {
+            this->add_vertex(u);
+            this->add_vertex(v);
+            const size_t su = this->m_index.at(u);
+            const size_t sv = this->m_index.at(v);
+            this->set(su, sv);
+            if (!this->m_directed)
+                this->set(sv, su);
+        }
+
+        /**
+         * @brief Removes a vertex and all of its edges from the graph.
+         *
+         * If the vertex does not exist in the graph, this function has no effect.
+         */
+        void remove_vertex(T v) {
+            auto it = this->m_index.find(v);
+            if (it == this->m_index.end())
+                return;
+
+            const size_t slot = it->second;
+            this->m_index.erase(it);
+
+            // Clear the row, then the column through the rows that point at the slot
+            const std::uint64_t* sources = this->m_directed ? this->column(slot) : this->row(slot);
+            for (size_t w = 0; w < this->m_words; ++w) {
+                for (std::uint64_t bits = sources[w]; bits != 0; bits &= bits - 1) {
+                    const size_t u = w * 64 + internal::lowest_bit(bits);
+                    this->row(u)[slot / 64] &= ~bit(slot);
+                }
+            }
+            if (this->m_directed) {
+                const std::uint64_t* targets = this->row(slot);
+                for (size_t w = 0; w < this->m_words; ++w) {
+                    for (std::uint64_t bits = targets[w]; bits != 0; bits &= bits - 1) {
+                        const size_t u = w * 64 + internal::lowest_bit(bits);
+                        this->column(u)[slot / 64] &= ~bit(slot);
+                    }
+                }
+                std::fill(this->column(slot), this->column(slot) + this->m_words, 0);
+            }
+            std::fill(this->row(slot), this->row(slot) + this->m_words, 0);
+            this->m_free.push_back(slot);
+        }
+
+        /**
+         * @brief Removes the edge from vertex `u` to vertex `v`, if any.
+         */
+        void remove_edge(T u, T v) {
+            const size_t su = this->slot_of(u);
+            const size_t sv = this->slot_of(v);
+            if (su == npos || sv == npos)
+                return;
+
+            this->clear(su, sv);
+            if (!this->m_directed)
+                this->clear(sv, su);
+        }
+
+        /**
+         * @brief Checks if the graph contains a vertex.
+         */
+        bool contains_vertex(T v) const {
+            return this->m_index.find(v) != this->m_index.end();
+        }
+
+        /**
+         * @brief Checks if the graph contains an edge from vertex `u` to vertex `v`.
+         */
+        bool contains_edge(T u, T v) const {
+            const size_t su = this->slot_of(u);
+            const size_t sv = this->slot_of(v);
+            return su != npos && sv != npos && (this->row(su)[sv / 64] & bit(sv)) != 0;
+        }
+
+        /**
+         * @brief Calculates the out-degree of a vertex, or 0 if the vertex is not in the graph.
+         */
+        size_t out_degree(T v) const {
+            const size_t slot = this->slot_of(v);
+            return slot != npos ? count(this->row(slot), this->m_words) : 0;
+        }
+
+        /**
+         * @brief Calculates the in-degree of a vertex, or 0 if the vertex is not in the graph.
+         */
+        size_t in_degree(T v) const {
+            const size_t slot = this->slot_of(v);
+            if (slot == npos)
+                return 0;
+
+            return count(this->m_directed ? this->column(slot) : this->row(slot), this->m_words);
+        }
+
+        /**
+         * @brief Calculates the degree of a vertex in an undirected graph, the out-degree otherwise.
+         */
+        size_t degree(T v) const {
+            return this->out_degree(v);
+        }
+
+        /**
+         * @brief Counts the vertices that are successors of both `u` and `v`.
+         */
+        size_t common_neighbors(T u, T v) const {
+            const size_t su = this->slot_of(u);
+            const size_t sv = this->slot_of(v);
+            if (su == npos || sv == npos)
+                return 0;
+
+            const std::uint64_t* a = this->row(su);
+            const std::uint64_t* b = this->row(sv);
+            return internal::popcount_words(a, b, this->m_words);
+        }
+
+        /**
+         * @brief Returns the list of successors of a vertex.
+         */
+        std::list<T> successors(T v) const {
+            const size_t slot = this->slot_of(v);
+            return slot != npos ? this->expand(this->row(slot)) : std::list<T>();
+        }
+
+        /**
+         * @brief Returns the list of predecessors of a vertex.
+         */
+        std::list<T> predecessors(T v) const {
+            const size_t slot = this->slot_of(v);
+            if (slot == npos)
+                return std::list<T>();
+
+            return this->expand(this->m_directed ? this->column(slot) : this->row(slot));
+        }
+
+        /**
+         * @brief Returns the list of neighbors of a vertex in an undirected graph, the successors otherwise.
+         */
+        std::list<T> neighbors(T v) const {
+            return this->successors(v);
+        }
+
+        /**
+         * @brief Breadth-First Search (BFS) algorithm.
+         *
+         * Every level is expanded at once: the next frontier is the OR of the rows of the current
+         * frontier without the visited set. Within a level vertices are visited in slot order.
+         *
+         * @param start The starting vertex for BFS traversal.
+         * @return A vector containing the vertices visited during BFS traversal.
+         */
+        std::vector<T> bfs(T start) const {
+            std::vector<T> visited;
+            const size_t source = this->slot_of(start);
+            if (source == npos)
+                return visited;
+
+            std::vector<std::uint64_t> seen(this->m_words, 0);
+            std::vector<std::uint64_t> frontier(this->m_words, 0);
+            std::vector<std::uint64_t> next(this->m_words);
+            seen[source / 64] = frontier[source / 64] = bit(source);
+
+            for (bool growing = true; growing;) {
+                std::fill(next.begin(), next.end(), 0);
+                for (size_t w = 0; w < this->m_words; ++w) {
+                    for (std::uint64_t bits = frontier[w]; bits != 0; bits &= bits - 1) {
+                        const size_t u = w * 64 + internal::lowest_bit(bits);
+                        visited.push_back(this->m_vertices[u]);
+
+                        const std::uint64_t* r = this->row(u);
+                        for (size_t i = 0; i < this->m_words; ++i) {
+                            next[i] |= r[i];
+                        }
+                    }
+                }
+
+                growing = false;
+                for (size_t i = 0; i < this->m_words; ++i) {
+                    next[i] &= ~seen[i];
+                    seen[i] |= next[i];
+                    growing = growing || next[i] != 0;
+                }
+                frontier.swap(next);
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Estimates the memory used by the graph.
+         *
+         * @return The estimated heap and object footprint, broken down by purpose.
+         */
+        memory_breakdown memory_usage() const {
+            memory_breakdown usage;
+            usage.vertex_table = this->m_vertices.size() * sizeof(T) + this->m_free.size() * sizeof(size_t);
+            usage.adjacency = (this->m_rows.size() + this->m_columns.size()) * sizeof(std::uint64_t);
+            usage.indexes = internal::hash_table_size(this->m_index.bucket_count(), this->m_index.size(), sizeof(std::pair<const T, size_t>));
+            usage.overhead = sizeof(*this)
+                + (this->m_vertices.capacity() - this->m_vertices.size()) * sizeof(T)
+                + (this->m_rows.capacity() - this->m_rows.size() + this->m_columns.capacity() - this->m_columns.size()) * sizeof(std::uint64_t);
+
+            return usage;
+        }
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        static std::uint64_t bit(size_t slot) {
+            return std::uint64_t{ 1 } << (slot % 64);
+        }
+
+        static size_t count(const std::uint64_t* words, size_t size) {
+            return internal::popcount_words(words, nullptr, size);
+        }
+
+        static std::vector<std::uint64_t> relayout(const std::vector<std::uint64_t>& matrix, size_t old_rows, size_t old_words, size_t rows, size_t words) {
+            std::vector<std::uint64_t> grown(rows * words, 0);
+            for (size_t r = 0; r < old_rows; ++r) {
+                std::copy(matrix.begin() + r * old_words, matrix.begin() + (r + 1) * old_words, grown.begin() + r * words);
+            }
+            return grown;
+        }
+
+        size_t slot_of(const T& v) const {
+            auto it = this->m_index.find(v);
+            return it != this->m_index.end() ? it->second : npos;
+        }
+
+        std::uint64_t* row(size_t slot) {
+            return this->m_rows.data() + slot * this->m_words;
+        }
+
+        const std::uint64_t* row(size_t slot) const {
+            return this->m_rows.data() + slot * this->m_words;
+        }
+
+        std::uint64_t* column(size_t slot) {
+            return this->m_columns.data() + slot * this->m_words;
+        }
+
+        const std::uint64_t* column(size_t slot) const {
+            return this->m_columns.data() + slot * this->m_words;
+        }
+
+        void set(size_t u, size_t v) {
+            this->row(u)[v / 64] |= bit(v);
+            if (this->m_directed)
+                this->column(v)[u / 64] |= bit(u);
+        }
+
+        void clear(size_t u, size_t v) {
+            this->row(u)[v / 64] &= ~bit(v);
+            if (this->m_directed)
+                this->column(v)[u / 64] &= ~bit(u);
+        }
+
+        std::list<T> expand(const std::uint64_t* words) const {
+            std::list<T> vertices;
+            for (size_t w = 0; w < this->m_words; ++w) {
+                for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                    vertices.push_back(this->m_vertices[w * 64 + internal::lowest_bit(bits)]);
+                }
+            }
+            return vertices;
+        }
+
+        bool m_directed;
+        size_t m_capacity{ 0 };
+        size_t m_words{ 0 };
+        std::vector<std::uint64_t> m_rows;
+        std::vector<std::uint64_t> m_columns;
+        std::vector<T> m_vertices;
+        std::vector<size_t> m_free;
+        std::unordered_map<T, size_t> m_index;
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,465 @@
+#pragma once
+
+#include "partition.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Returns the number of threads of the calling process, or 0 if it cannot be determined.
+         */
+        inline size_t running_threads() {
+            DIR* tasks = ::opendir("/proc/self/task");
+            if (tasks == nullptr)
+                return 0;
+
+            size_t count{ 0 };
+            while (const dirent* entry = ::readdir(tasks)) {
+                if (entry->d_name[0] != '.')
+                    ++count;
+            }
+            ::closedir(tasks);
+            return count;
+        }
+
+        /**
+         * @brief Runs min-propagation supersteps over a partitioned graph with one worker process per partition.
+         *
+         * Workers are forked before any partition is sent and never touch the coordinator's data;
+         * each one receives only its own partition over its Unix socket pair and owns the values
+         * of its master vertices. A superstep has two phases that both end with a barrier: active
+         * vertices are sent to the partitions holding their out-edges, which emit
+         * `value + increment` for every target, and the candidates are sent to the owners of the
+         * targets, which keep the minimum and report the values that changed.
+         *
+         * Workers are forked without exec, so a lock held by another thread at the time of the fork,
+         * e.g. inside malloc, would stay locked forever in the worker. The runner therefore refuses
+         * to start while the process runs other threads; where the thread count cannot be read
+         * (outside Linux) the caller has to ensure this.
+         */
+        template<typename T>
+        class bsp_runner {
+        public:
+            using value_type = std::uint64_t;
+
+            static constexpr value_type unset = std::numeric_limits<value_type>::max();
+
+            /**
+             * @brief Starts one worker per partition and sends each worker its partition.
+             *
+             * @throws std::logic_error if the process runs other threads.
+             * @throws std::system_error if a worker cannot be started or loaded.
+             */
+            explicit bsp_runner(const partitioned_graph<T>& graph) : m_graph(graph) {
+                if (running_threads() > 1)
+                    throw std::logic_error("bsp_runner: cannot fork workers while other threads are running");
+
+                for (size_t p = 0; p < graph.partition_count(); ++p) {
+                    int fds[2];
+                    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+                        this->shutdown();
+                        throw std::system_error(errno, std::generic_category(), "socketpair");
+                    }
+
+                    const pid_t pid = ::fork();
+                    if (pid < 0) {
+                        ::close(fds[0]);
+                        ::close(fds[1]);
+                        this->shutdown();
+                        throw std::system_error(errno, std::generic_category(), "fork");
+                    }
+
+                    if (pid == 0) {
+                        // The worker must never return into the coordinator's code
+                        try {
+                            ::close(fds[0]);
+                            for (int fd : this->m_sockets) {
+                                ::close(fd);
+                            }
+                            ::_exit(run_worker(fds[1]) ? 0 : 1);
+                        }
+                        catch (...) {
+                            ::_exit(2);
+                        }
+                    }
+
+                    ::close(fds[1]);
+                    this->m_sockets.push_back(fds[0]);
+                    this->m_workers.push_back(pid);
+                }
+
+                // Ship the partitions one at a time, so only one serialized copy exists at once
+                std::vector<value_type> payload;
+                for (size_t p = 0; p < this->m_sockets.size(); ++p) {
+                    encode_partition(graph.part(p), payload);
+                    if (!send_message(this->m_sockets[p], command::load, payload)) {
+                        const int error = errno;
+                        this->shutdown();
+                        throw std::system_error(error, std::generic_category(), "send partition to worker");
+                    }
+                }
+                for (size_t p = 0; p < this->m_sockets.size(); ++p) {
+                    command reply_tag;
+                    if (!receive_message(this->m_sockets[p], reply_tag, payload)) {
+                        const int error = errno;
+                        this->shutdown();
+                        throw std::system_error(error, std::generic_category(), "load partition in worker");
+                    }
+                }
+            }
+
+            ~bsp_runner() {
+                this->shutdown();
+            }
+
+            bsp_runner(const bsp_runner&) = delete;
+            bsp_runner& operator=(const bsp_runner&) = delete;
+
+            /**
+             * @brief Propagates values from the initially active vertices until no value changes.
+             *
+             * @param initial The initial (vertex, value) pairs.
+             * @param increment The amount added to a value when it crosses an edge.
+             * @return The final value of every vertex, `unset` for vertices never reached.
+             */
+            std::vector<value_type> propagate(const std::vector<std::pair<size_t, value_type>>& initial, value_type increment) {
+                const size_t parts = this->m_graph.partition_count();
+                std::vector<std::vector<value_type>> outgoing(parts);
+
+                this->broadcast(command::reset, outgoing);
+
+                // Seed the owners of the initial vertices
+                for (const auto& entry : initial) {
+                    auto& message = outgoing[this->m_graph.owner(entry.first)];
+                    message.push_back(entry.first);
+                    message.push_back(entry.second);
+                }
+                std::vector<std::vector<value_type>> active = this->exchange(command::apply, outgoing);
+
+                while (!all_empty(active)) {
+                    // Phase 1: route active vertices to every partition holding their out-edges
+                    for (auto& message : outgoing) {
+                        message.clear();
+                    }
+                    for (const auto& changed : active) {
+                        for (size_t i = 0; i < changed.size(); i += 2) {
+                            for (size_t holder : this->m_graph.holders(static_cast<size_t>(changed[i]))) {
+                                outgoing[holder].push_back(changed[i]);
+                                outgoing[holder].push_back(changed[i + 1] + increment);
+                            }
+                        }
+                    }
+                    const auto candidates = this->exchange(command::expand, outgoing);
+
+                    // Phase 2: route candidates to the owners of the targets
+                    for (auto& message : outgoing) {
+                        message.clear();
+                    }
+                    for (const auto& produced : candidates) {
+                        for (size_t i = 0; i < produced.size(); i += 2) {
+                            auto& message = outgoing[this->m_graph.owner(static_cast<size_t>(produced[i]))];
+                            message.push_back(produced[i]);
+                            message.push_back(produced[i + 1]);
+                        }
+                    }
+                    active = this->exchange(command::apply, outgoing);
+                }
+
+                for (auto& message : outgoing) {
+                    message.clear();
+                }
+                std::vector<value_type> values(this->m_graph.size(), unset);
+                for (const auto& collected : this->exchange(command::collect, outgoing)) {
+                    for (size_t i = 0; i < collected.size(); i += 2) {
+                        values[static_cast<size_t>(collected[i])] = collected[i + 1];
+                    }
+                }
+
+                return values;
+            }
+
+        private:
+            enum class command : value_type { load, reset, apply, expand, collect, exit };
+
+            /**
+             * @brief Serializes the parts of a partition a worker needs: the sizes, then masters, sources, offsets and targets.
+             */
+            static void encode_partition(const graph_partition& part, std::vector<value_type>& payload) {
+                payload.clear();
+                payload.reserve(3 + part.masters.size() + part.sources.size() + part.offsets.size() + part.targets.size());
+                payload.push_back(part.masters.size());
+                payload.push_back(part.sources.size());
+                payload.push_back(part.targets.size());
+                payload.insert(payload.end(), part.masters.begin(), part.masters.end());
+                payload.insert(payload.end(), part.sources.begin(), part.sources.end());
+                payload.insert(payload.end(), part.offsets.begin(), part.offsets.end());
+                payload.insert(payload.end(), part.targets.begin(), part.targets.end());
+            }
+
+            static bool decode_partition(const std::vector<value_type>& payload, graph_partition& part) {
+                if (payload.size() < 3)
+                    return false;
+
+                const size_t masters = static_cast<size_t>(payload[0]);
+                const size_t sources = static_cast<size_t>(payload[1]);
+                const size_t targets = static_cast<size_t>(payload[2]);
+                if (payload.size() != 3 + masters + sources + (sources + 1) + targets)
+                    return false;
+
+                auto it = payload.begin() + 3;
+                part.masters.assign(it, it + masters);
+                it += masters;
+                part.sources.assign(it, it + sources);
+                it += sources;
+                part.offsets.assign(it, it + sources + 1);
+                it += sources + 1;
+                part.targets.assign(it, it + targets);
+                return true;
+            }
+
+            static bool all_empty(const std::vector<std::vector<value_type>>& messages) {
+                for (const auto& message : messages) {
+                    if (!message.empty())
+                        return false;
+                }
+                return true;
+            }
+
+            static bool write_all(int fd, const void* data, size_t size) {
+                const char* bytes = static_cast<const char*>(data);
+                while (size > 0) {
+#if defined(MSG_NOSIGNAL)
+                    const ssize_t written = ::send(fd, bytes, size, MSG_NOSIGNAL);
+#else
+                    const ssize_t written = ::send(fd, bytes, size, 0);
+#endif
+                    if (written < 0 && errno == EINTR)
+                        continue;
+                    if (written <= 0)
+                        return false;
+                    bytes += written;
+                    size -= static_cast<size_t>(written);
+                }
+                return true;
+            }
+
+            static bool read_all(int fd, void* data, size_t size) {
+                char* bytes = static_cast<char*>(data);
+                while (size > 0) {
+                    const ssize_t received = ::recv(fd, bytes, size, 0);
+                    if (received < 0 && errno == EINTR)
+                        continue;
+                    if (received <= 0)
+                        return false;
+                    bytes += received;
+                    size -= static_cast<size_t>(received);
+                }
+                return true;
+            }
+
+            static bool send_message(int fd, command tag, const std::vector<value_type>& payload) {
+                const value_type header[2] = { static_cast<value_type>(tag), payload.size() };
+                return write_all(fd, header, sizeof(header))
+                    && write_all(fd, payload.data(), payload.size() * sizeof(value_type));
+            }
+
+            static bool receive_message(int fd, command& tag, std::vector<value_type>& payload) {
+                value_type header[2];
+                if (!read_all(fd, header, sizeof(header)))
+                    return false;
+
+                tag = static_cast<command>(header[0]);
+                payload.resize(static_cast<size_t>(header[1]));
+                return read_all(fd, payload.data(), payload.size() * sizeof(value_type));
+            }
+
+            static bool run_worker(int fd) {
+                std::vector<value_type> payload;
+                command tag;
+                graph_partition part;
+                if (!receive_message(fd, tag, payload) || tag != command::load || !decode_partition(payload, part))
+                    return false;
+                if (!send_message(fd, tag, {}))
+                    return false;
+
+                std::unordered_map<size_t, size_t> master_index;
+                std::unordered_map<size_t, size_t> row_index;
+                for (size_t i = 0; i < part.masters.size(); ++i) {
+                    master_index.emplace(part.masters[i], i);
+                }
+                for (size_t i = 0; i < part.sources.size(); ++i) {
+                    row_index.emplace(part.sources[i], i);
+                }
+
+                std::vector<value_type> values(part.masters.size(), unset);
+                std::vector<value_type> reply;
+
+                while (receive_message(fd, tag, payload)) {
+                    reply.clear();
+                    switch (tag) {
+                    case command::load:
+                        return false;
+                    case command::reset:
+                        std::fill(values.begin(), values.end(), unset);
+                        break;
+                    case command::apply:
+                        for (size_t i = 0; i < payload.size(); i += 2) {
+                            auto& value = values[master_index.at(static_cast<size_t>(payload[i]))];
+                            if (payload[i + 1] < value) {
+                                value = payload[i + 1];
+                                reply.push_back(payload[i]);
+                                reply.push_back(value);
+                            }
+                        }
+                        break;
+                    case command::expand:
+                        for (size_t i = 0; i < payload.size(); i += 2) {
+                            const size_t row = row_index.at(static_cast<size_t>(payload[i]));
+                            for (size_t e = part.offsets[row]; e < part.offsets[row + 1]; ++e) {
+                                reply.push_back(part.targets[e]);
+                                reply.push_back(payload[i + 1]);
+                            }
+                        }
+                        break;
+                    case command::collect:
+                        for (size_t i = 0; i < values.size(); ++i) {
+                            if (values[i] != unset) {
+                                reply.push_back(part.masters[i]);
+                                reply.push_back(values[i]);
+                            }
+                        }
+                        break;
+                    case command::exit:
+                        return true;
+                    }
+
+                    if (!send_message(fd, tag, reply))
+                        return false;
+                }
+
+                return false;
+            }
+
+            void broadcast(command tag, const std::vector<std::vector<value_type>>& messages) {
+                this->exchange(tag, messages);
+            }
+
+            std::vector<std::vector<value_type>> exchange(command tag, const std::vector<std::vector<value_type>>& messages) {
+                for (size_t p = 0; p < this->m_sockets.size(); ++p) {
+                    if (!send_message(this->m_sockets[p], tag, messages[p]))
+                        throw std::system_error(errno, std::generic_category(), "send to worker");
+                }
+
+                // Barrier: wait for every worker to finish the superstep phase
+                std::vector<std::vector<value_type>> replies(this->m_sockets.size());
+                for (size_t p = 0; p < this->m_sockets.size(); ++p) {
+                    command reply_tag;
+                    if (!receive_message(this->m_sockets[p], reply_tag, replies[p]))
+                        throw std::system_error(errno, std::generic_category(), "receive from worker");
+                }
+
+                return replies;
+            }
+
+            void shutdown() {
+                for (int fd : this->m_sockets) {
+                    send_message(fd, command::exit, {});
+                    ::close(fd);
+                }
+                for (pid_t pid : this->m_workers) {
+                    int status;
+                    while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+                    }
+                }
+                this->m_sockets.clear();
+                this->m_workers.clear();
+            }
+
+            const partitioned_graph<T>& m_graph;
+            std::vector<int> m_sockets;
+            std::vector<pid_t> m_workers;
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief Breadth-First Search (BFS) with one worker process per partition.
+     *
+     * @param graph The partitioned graph.
+     * @param start The starting vertex for BFS traversal.
+     * @return The hop distance from `start` of every reachable vertex.
+     */
+    template<typename T>
+    std::unordered_map<T, size_t> distributed_bfs(const partitioned_graph<T>& graph, const T& start) {
+        std::unordered_map<T, size_t> distances;
+        size_t source = graph.size();
+        for (size_t id = 0; id < graph.size(); ++id) {
+            if (graph.vertex_at(id) == start) {
+                source = id;
+                break;
+            }
+        }
+
+        if (source == graph.size())
+            return distances;
+
+        internal::bsp_runner<T> runner(graph);
+        const auto values = runner.propagate({ { source, 0 } }, 1);
+        for (size_t id = 0; id < values.size(); ++id) {
+            if (values[id] != internal::bsp_runner<T>::unset) {
+                distances.emplace(graph.vertex_at(id), static_cast<size_t>(values[id]));
+            }
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Connected components with one worker process per partition.
+     *
+     * The partitioned graph must store edges in both directions, e.g. a `csr_graph` built from an
+     * `undirected_graph`; on directed graphs the result follows edge directions only.
+     *
+     * @param graph The partitioned graph.
+     * @return The representative of the component of every vertex, the vertex with the smallest dense id.
+     */
+    template<typename T>
+    std::unordered_map<T, T> distributed_connected_components(const partitioned_graph<T>& graph) {
+        std::vector<std::pair<size_t, std::uint64_t>> labels;
+        labels.reserve(graph.size());
+        for (size_t id = 0; id < graph.size(); ++id) {
+            labels.emplace_back(id, id);
+        }
+
+        internal::bsp_runner<T> runner(graph);
+        const auto values = runner.propagate(labels, 0);
+
+        std::unordered_map<T, T> components;
+        for (size_t id = 0; id < values.size(); ++id) {
+            components.emplace(graph.vertex_at(id), graph.vertex_at(static_cast<size_t>(values[id])));
+        }
+
+        return components;
+    }
+
+} // end of namespace grphx
+
+#endif
@@ -0,0 +1,449 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/types.h>
+#endif
+
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Options of the semi-external algorithms.
+     */
+    struct external_options {
+        size_t memory_budget{ size_t{ 64 } << 20 }; ///< Bytes for per-vertex state and read buffers together.
+    };
+
+    namespace internal {
+
+        /**
+         * @brief Header of an on-disk CSR file, followed by `vertices + 1` offsets and `edges` targets.
+         *
+         * All fields are 64-bit integers in the byte order of the machine that wrote the file.
+         */
+        struct csr_file_header {
+            char magic[8];
+            std::uint64_t version;
+            std::uint64_t vertices;
+            std::uint64_t edges;
+            std::uint64_t directed;
+        };
+
+        constexpr char csr_file_magic[8] = { 'G', 'R', 'P', 'H', 'X', 'C', 'S', 'R' };
+
+        struct file_closer {
+            void operator()(std::FILE* file) const {
+                std::fclose(file);
+            }
+        };
+
+        using file_handle = std::unique_ptr<std::FILE, file_closer>;
+
+        inline file_handle open_file(const std::string& path, const char* mode) {
+            file_handle file(std::fopen(path.c_str(), mode));
+            if (!file)
+                throw std::system_error(errno, std::generic_category(), "open " + path);
+            return file;
+        }
+
+        /**
+         * @brief Moves to an absolute byte position, also beyond 2 GiB where `long` has 32 bits.
+         */
+        inline int seek(std::FILE* file, std::uint64_t offset) {
+#if defined(_MSC_VER)
+            return ::_fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#elif defined(__unix__) || defined(__APPLE__)
+            return ::fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#else
+            return std::fseek(file, static_cast<long>(offset), SEEK_SET);
+#endif
+        }
+
+        /**
+         * @brief Reads a range of 64-bit values front to back through a fixed-size buffer.
+         */
+        class sequential_reader {
+        public:
+            sequential_reader(const std::string& path, std::uint64_t offset, std::uint64_t count, size_t buffer_values)
+                : m_file(open_file(path, "rb")), m_buffer(std::max<size_t>(buffer_values, 1)), m_remaining(count) {
+#if defined(__unix__) && defined(POSIX_FADV_SEQUENTIAL)
+                // Ask the kernel for aggressive read-ahead
+                ::posix_fadvise(::fileno(this->m_file.get()), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+                std::setvbuf(this->m_file.get(), nullptr, _IONBF, 0);
+                if (seek(this->m_file.get(), offset) != 0)
+                    throw std::system_error(errno, std::generic_category(), "seek " + path);
+            }
+
+            /**
+             * @brief Returns the next value; must not be called past the end of the range.
+             */
+            std::uint64_t next() {
+                if (this->m_position == this->m_filled)
+                    this->refill();
+                return this->m_buffer[this->m_position++];
+            }
+
+        private:
+            void refill() {
+                const size_t wanted = static_cast<size_t>(std::min<std::uint64_t>(this->m_buffer.size(), this->m_remaining));
+                this->m_filled = std::fread(this->m_buffer.data(), sizeof(std::uint64_t), wanted, this->m_file.get());
+                if (this->m_filled != wanted || wanted == 0)
+                    throw std::runtime_error("csr file: unexpected end of file");
+                this->m_remaining -= this->m_filled;
+                this->m_position = 0;
+            }
+
+            file_handle m_file;
+            std::vector<std::uint64_t> m_buffer;
+            std::uint64_t m_remaining;
+            size_t m_filled{ 0 };
+            size_t m_position{ 0 };
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief A CSR graph stored on disk, for graphs whose edges do not fit in memory.
+     *
+     * Only the header is kept in memory. Vertices are the dense ids 0, 1, ..., size() - 1. The
+     * algorithms stream the offsets and targets sequentially, so the file is read front to back
+     * and benefits from the read-ahead of the operating system.
+     */
+    class csr_file {
+    public:
+        /**
+         * @brief Opens an existing file written by `write_csr_file`.
+         *
+         * @param path The path of the file.
+         * @throws std::system_error if the file cannot be opened, std::runtime_error if it is not a CSR file.
+         */
+        explicit csr_file(std::string path) : m_path(std::move(path)) {
+            internal::file_handle file = internal::open_file(this->m_path, "rb");
+            if (std::fread(&this->m_header, sizeof(this->m_header), 1, file.get()) != 1
+                || std::memcmp(this->m_header.magic, internal::csr_file_magic, sizeof(internal::csr_file_magic)) != 0
+                || this->m_header.version != 1)
+                throw std::runtime_error("csr file: " + this->m_path + " is not a grphx CSR file");
+        }
+
+        /**
+         * @brief Returns the number of vertices.
+         */
+        std::uint64_t size() const {
+            return this->m_header.vertices;
+        }
+
+        /**
+         * @brief Returns the number of stored edges (undirected edges count twice).
+         */
+        std::uint64_t edge_count() const {
+            return this->m_header.edges;
+        }
+
+        /**
+         * @brief Checks if the graph was built from directed edges.
+         */
+        bool is_directed() const {
+            return this->m_header.directed != 0;
+        }
+
+        /**
+         * @brief Calls `function(u, v)` for every stored edge, in row order.
+         *
+         * @param buffer_bytes The size of each of the two read buffers, at least one value.
+         * @param function Callable `void(std::uint64_t u, std::uint64_t v)`.
+         * @throws std::runtime_error if the offsets are not a valid CSR row index or a target is not a vertex.
+         */
+        template<typename Function>
+        void for_each_edge(size_t buffer_bytes, Function&& function) const {
+            const size_t values = std::max<size_t>(buffer_bytes / sizeof(std::uint64_t), 1);
+            const std::uint64_t targets_at = sizeof(internal::csr_file_header) + (this->size() + 1) * sizeof(std::uint64_t);
+            internal::sequential_reader offsets(this->m_path, sizeof(internal::csr_file_header), this->size() + 1, values);
+            internal::sequential_reader targets(this->m_path, targets_at, this->edge_count(), values);
+
+            // The algorithms index per-vertex state with these values, so a foreign or damaged file must not get through
+            std::uint64_t end = offsets.next();
+            if (end != 0)
+                this->corrupt();
+            for (std::uint64_t u = 0; u < this->size(); ++u) {
+                const std::uint64_t begin = end;
+                end = offsets.next();
+                if (end < begin || end > this->edge_count())
+                    this->corrupt();
+                for (std::uint64_t e = begin; e < end; ++e) {
+                    const std::uint64_t v = targets.next();
+                    if (v >= this->size())
+                        this->corrupt();
+                    function(u, v);
+                }
+            }
+            if (end != this->edge_count())
+                this->corrupt();
+        }
+
+    private:
+        [[noreturn]] void corrupt() const {
+            throw std::runtime_error("csr file: " + this->m_path + " has invalid offsets or targets");
+        }
+
+        std::string m_path;
+        internal::csr_file_header m_header{};
+    };
+
+    /**
+     * @brief Writes a `csr_file` row by row, so that graphs larger than memory can be stored.
+     *
+     * The edges must arrive grouped by source in increasing order. Offsets and targets are
+     * streamed to their sections of the file as they come; only the running edge count is kept
+     * in memory. The file is marked valid by `finish`, so an interrupted write leaves a file
+     * that `csr_file` rejects.
+     */
+    class csr_file_writer {
+    public:
+        /**
+         * @brief Creates the file.
+         *
+         * @param path The path of the file, which is overwritten.
+         * @param vertices The number of vertices; sources and targets must be below it.
+         * @param directed Whether the edges are directed; undirected edges must be added in both directions.
+         * @throws std::system_error if the file cannot be created.
+         */
+        csr_file_writer(std::string path, std::uint64_t vertices, bool directed)
+            : m_path(std::move(path)), m_offsets(internal::open_file(this->m_path, "wb")), m_vertices(vertices), m_directed(directed) {
+            // Leave the header invalid until the write is complete
+            const internal::csr_file_header header{};
+            this->write(this->m_offsets.get(), &header, sizeof(header), 1);
+            this->write_offset(0);
+            this->m_targets = internal::open_file(this->m_path, "r+b");
+            if (internal::seek(this->m_targets.get(), sizeof(internal::csr_file_header) + (vertices + 1) * sizeof(std::uint64_t)) != 0)
+                throw std::system_error(errno, std::generic_category(), "seek " + this->m_path);
+        }
+
+        /**
+         * @brief Appends an edge; the source must not be smaller than that of the previous edge.
+         *
+         * @throws std::invalid_argument if the edge is out of order or not between vertices of the file.
+         */
+        void add_edge(std::uint64_t u, std::uint64_t v) {
+            if (u < this->m_row || u >= this->m_vertices || v >= this->m_vertices || this->m_finished)
+                throw std::invalid_argument("csr file writer: edges must be sorted by source and between existing vertices");
+
+            this->close_rows(u);
+            this->write(this->m_targets.get(), &v, sizeof(v), 1);
+            ++this->m_edges;
+        }
+
+        /**
+         * @brief Appends the row of a vertex; rows must be added in increasing order.
+         *
+         * @param u The source vertex.
+         * @param first The first target.
+         * @param last Past the last target.
+         */
+        template<typename Iterator>
+        void add_row(std::uint64_t u, Iterator first, Iterator last) {
+            for (; first != last; ++first) {
+                this->add_edge(u, static_cast<std::uint64_t>(*first));
+            }
+            if (u >= this->m_row && u < this->m_vertices)
+                this->close_rows(u);
+        }
+
+        /**
+         * @brief Writes the remaining offsets and the header, which makes the file readable.
+         *
+         * @throws std::system_error if the file cannot be written.
+         */
+        void finish() {
+            if (this->m_finished)
+                return;
+
+            this->close_rows(this->m_vertices);
+            internal::csr_file_header header{};
+            std::memcpy(header.magic, internal::csr_file_magic, sizeof(header.magic));
+            header.version = 1;
+            header.vertices = this->m_vertices;
+            header.edges = this->m_edges;
+            header.directed = this->m_directed ? 1 : 0;
+
+            if (std::fflush(this->m_targets.get()) != 0 || std::fflush(this->m_offsets.get()) != 0
+                || internal::seek(this->m_offsets.get(), 0) != 0)
+                throw std::system_error(errno, std::generic_category(), "write " + this->m_path);
+            this->write(this->m_offsets.get(), &header, sizeof(header), 1);
+            if (std::fflush(this->m_offsets.get()) != 0)
+                throw std::system_error(errno, std::generic_category(), "write " + this->m_path);
+            this->m_finished = true;
+        }
+
+    private:
+        /**
+         * @brief Ends every row before `row`: their offsets are all the current edge count.
+         */
+        void close_rows(std::uint64_t row) {
+            for (; this->m_row < row; ++this->m_row) {
+                this->write_offset(this->m_edges);
+            }
+        }
+
+        void write_offset(std::uint64_t offset) {
+            this->write(this->m_offsets.get(), &offset, sizeof(offset), 1);
+        }
+
+        void write(std::FILE* file, const void* data, size_t size, size_t count) {
+            if (std::fwrite(data, size, count, file) != count)
+                throw std::system_error(errno, std::generic_category(), "write " + this->m_path);
+        }
+
+        std::string m_path;
+        internal::file_handle m_offsets;
+        internal::file_handle m_targets;
+        std::uint64_t m_vertices;
+        bool m_directed;
+        std::uint64_t m_row{ 0 };   ///< Rows before this one have their end offset written.
+        std::uint64_t m_edges{ 0 };
+        bool m_finished{ false };
+    };
+
+    /**
+     * @brief Writes a CSR graph to disk in the format read by `csr_file`.
+     *
+     * The vertex keys are not stored; vertex `id` on disk is `graph.vertex_at(id)`. The rows are
+     * streamed from the graph without an intermediate copy.
+     *
+     * @param graph The graph.
+     * @param path The path of the file, which is overwritten.
+     * @throws std::system_error if the file cannot be written.
+     */
+    template<typename T>
+    void write_csr_file(const csr_graph<T>& graph, const std::string& path) {
+        csr_file_writer writer(path, graph.size(), graph.is_directed());
+        for (size_t u = 0; u < graph.size(); ++u) {
+            writer.add_row(u, graph.row_begin(u), graph.row_end(u));
+        }
+        writer.finish();
+    }
+
+    namespace internal {
+
+        /**
+         * @brief Returns the read buffer size left by the budget once `state_bytes` of per-vertex state are held.
+         */
+        inline size_t buffer_budget(const external_options& options, size_t state_bytes) {
+            if (state_bytes >= options.memory_budget)
+                throw std::length_error("external graph: per-vertex state exceeds the memory budget");
+
+            const size_t buffer = (options.memory_budget - state_bytes) / 2;
+            if (buffer < sizeof(std::uint64_t))
+                throw std::length_error("external graph: the memory budget leaves no room for the read buffers");
+            return buffer;
+        }
+
+    } // end of namespace internal
+
+    /**
+     * @brief Semi-external Breadth-First Search (BFS).
+     *
+     * Keeps a visited and a frontier bit per vertex and the distances in memory. Every level is
+     * one sequential pass over the file that follows the edges of the frontier, so the file is
+     * read as many times as the search is deep.
+     *
+     * @param file The graph.
+     * @param source The start vertex.
+     * @param options The memory budget.
+     * @return The distance in edges of every vertex from `source`, or the maximum value if unreachable.
+     */
+    inline std::vector<std::uint32_t> external_bfs(const csr_file& file, std::uint64_t source, const external_options& options = {}) {
+        constexpr std::uint32_t unreached = std::numeric_limits<std::uint32_t>::max();
+        const size_t n = static_cast<size_t>(file.size());
+        const size_t buffer = internal::buffer_budget(options, n * sizeof(std::uint32_t) + 3 * ((n + 7) / 8));
+
+        std::vector<std::uint32_t> distance(n, unreached);
+        if (source >= n)
+            return distance;
+
+        std::vector<bool> frontier(n, false);
+        std::vector<bool> next(n, false);
+        distance[source] = 0;
+        frontier[source] = true;
+
+        for (std::uint32_t level = 1; ; ++level) {
+            bool grown = false;
+            file.for_each_edge(buffer, [&](std::uint64_t u, std::uint64_t v) {
+                if (frontier[u] && distance[v] == unreached) {
+                    distance[v] = level;
+                    next[v] = true;
+                    grown = true;
+                }
+            });
+
+            if (!grown)
+                break;
+            frontier.swap(next);
+            next.assign(n, false);
+        }
+
+        return distance;
+    }
+
+    /**
+     * @brief Semi-external connected components with a single pass over the file.
+     *
+     * Keeps one union-find parent per vertex in memory and unites the endpoints of every edge
+     * while streaming the file once. Edge directions are ignored, so directed graphs yield their
+     * weakly connected components.
+     *
+     * @param file The graph.
+     * @param options The memory budget.
+     * @return The component of every vertex, numbered 0, 1, ... in order of the smallest vertex of each component.
+     */
+    inline std::vector<std::uint64_t> external_connected_components(const csr_file& file, const external_options& options = {}) {
+        const size_t n = static_cast<size_t>(file.size());
+        const size_t buffer = internal::buffer_budget(options, n * sizeof(std::uint64_t));
+
+        std::vector<std::uint64_t> parent(n);
+        for (size_t v = 0; v < n; ++v) {
+            parent[v] = v;
+        }
+        auto find = [&parent](std::uint64_t x) {
+            while (parent[x] != x) {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+
+        // Linking the larger root below the smaller keeps every root the smallest vertex of its set
+        file.for_each_edge(buffer, [&](std::uint64_t u, std::uint64_t v) {
+            const std::uint64_t ru = find(u);
+            const std::uint64_t rv = find(v);
+            if (ru < rv)
+                parent[rv] = ru;
+            else if (rv < ru)
+                parent[ru] = rv;
+        });
+
+        // Roots come before their members, so one forward pass relabels every vertex in place
+        std::uint64_t components{ 0 };
+        for (size_t v = 0; v < n; ++v) {
+            parent[v] = parent[v] == v ? components++ : parent[parent[v]];
+        }
+
+        return parent;
+    }
+
+} // end of namespace grphx
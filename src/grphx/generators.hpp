@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "grphx.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief A generated graph: the vertices 0, 1, ..., vertices - 1 and a list of edges between them.
+     */
+    struct edge_list {
+        size_t vertices{ 0 };                            ///< The number of vertices.
+        std::vector<std::pair<size_t, size_t>> edges;    ///< The edges as (source, destination) pairs.
+    };
+
+    namespace internal {
+
+        /**
+         * @brief Random number stream derived from a seed and a stream number.
+         *
+         * Every row, edge or position of a generator draws from its own stream, so the output does
+         * not depend on how the work is split over threads.
+         */
+        class counter_rng {
+        public:
+            counter_rng(std::uint64_t seed, std::uint64_t stream) : m_state(mix64(seed ^ mix64(stream))) {}
+
+            /**
+             * @brief Returns the next 64 random bits.
+             */
+            std::uint64_t next() {
+                return mix64(this->m_state++);
+            }
+
+            /**
+             * @brief Returns a random number in [0, 1).
+             */
+            double uniform() {
+                return static_cast<double>(this->next() >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+        private:
+            std::uint64_t m_state;
+        };
+
+        /**
+         * @brief Runs `row(r, edges)` for every row in parallel and concatenates the edges in row order.
+         */
+        template<typename Row>
+        std::vector<std::pair<size_t, size_t>> generate_rows(size_t rows, size_t threads, Row&& row) {
+            std::vector<std::vector<std::pair<size_t, size_t>>> parts(worker_count(threads, rows));
+            parallel_for(rows, threads, [&](size_t worker, size_t begin, size_t end) {
+                for (size_t r = begin; r < end; ++r) {
+                    row(r, parts[worker]);
+                }
+            });
+
+            std::vector<size_t> offsets(parts.size() + 1, 0);
+            for (size_t w = 0; w < parts.size(); ++w) {
+                offsets[w + 1] = offsets[w] + parts[w].size();
+            }
+
+            std::vector<std::pair<size_t, size_t>> edges(offsets.back());
+            parallel_for(parts.size(), parts.size(), [&](size_t, size_t begin, size_t end) {
+                for (size_t w = begin; w < end; ++w) {
+                    std::copy(parts[w].begin(), parts[w].end(), edges.begin() + offsets[w]);
+                    std::vector<std::pair<size_t, size_t>>().swap(parts[w]);
+                }
+            });
+
+            return edges;
+        }
+
+        template<typename Graph, typename T>
+        void add_edge_list(Graph& graph, const edge_list& list) {
+            std::vector<T> vertices;
+            vertices.reserve(list.vertices);
+            for (size_t v = 0; v < list.vertices; ++v) {
+                vertices.push_back(T(v));
+            }
+
+            graph.add_vertices(vertices);
+            graph.add_edges(list.edges.begin(), list.edges.end());
+        }
+
+    } // end of namespace internal
+
+    /**
+     * @brief Generates a Recursive Matrix (R-MAT) graph.
+     *
+     * Every edge picks one quadrant of the adjacency matrix per bit of the vertex ids, with
+     * probabilities `a`, `b`, `c` and `1 - a - b - c`, which yields the skewed degrees and
+     * community structure of real-world graphs. Edges are generated independently, so the list
+     * may hold self-loops and duplicates.
+     *
+     * @param scale The base-2 logarithm of the number of vertices.
+     * @param edge_factor The number of edges per vertex.
+     * @param a The probability of the top-left quadrant.
+     * @param b The probability of the top-right quadrant.
+     * @param c The probability of the bottom-left quadrant.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @param seed The seed; the result does not depend on the number of threads.
+     * @return The `2^scale` vertices and `edge_factor * 2^scale` directed edges.
+     */
+    inline edge_list rmat_graph(size_t scale, size_t edge_factor, double a, double b, double c, size_t threads = 0, std::uint64_t seed = 0) {
+        edge_list list;
+        list.vertices = size_t{ 1 } << scale;
+        list.edges.resize(edge_factor * list.vertices);
+
+        const double ab = a + b;
+        const double abc = a + b + c;
+        internal::parallel_for(list.edges.size(), threads, [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                internal::counter_rng rng(seed, i);
+                size_t u{ 0 };
+                size_t v{ 0 };
+                for (size_t level = 0; level < scale; ++level) {
+                    const double r = rng.uniform();
+                    u = (u << 1) | (r >= ab ? 1 : 0);
+                    v = (v << 1) | ((r >= a && r < ab) || r >= abc ? 1 : 0);
+                }
+                list.edges[i] = { u, v };
+            }
+        });
+
+        return list;
+    }
+
+    /**
+     * @brief Generates a Kronecker graph as specified by the Graph500 benchmark.
+     *
+     * An R-MAT graph with the Graph500 probabilities a = 0.57, b = 0.19 and c = 0.19 whose vertex
+     * ids are randomly permuted, so that the high-degree vertices are not the lowest ids.
+     *
+     * @param scale The base-2 logarithm of the number of vertices.
+     * @param edge_factor The number of edges per vertex; Graph500 uses 16.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @param seed The seed; the result does not depend on the number of threads.
+     * @return The `2^scale` vertices and `edge_factor * 2^scale` edges.
+     */
+    inline edge_list kronecker_graph(size_t scale, size_t edge_factor = 16, size_t threads = 0, std::uint64_t seed = 0) {
+        edge_list list = rmat_graph(scale, edge_factor, 0.57, 0.19, 0.19, threads, seed);
+
+        const std::uint64_t permutation_seed = internal::mix64(seed ^ 0x4b726f6e65636b65ULL);
+        std::vector<std::pair<std::uint64_t, size_t>> keys(list.vertices);
+        internal::parallel_for(list.vertices, threads, [&](size_t, size_t begin, size_t end) {
+            for (size_t v = begin; v < end; ++v) {
+                keys[v] = { internal::mix64(permutation_seed ^ v), v };
+            }
+        });
+        internal::parallel_sort(keys, std::less<std::pair<std::uint64_t, size_t>>(), threads);
+
+        std::vector<size_t> label(list.vertices);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            label[keys[i].second] = i;
+        }
+        internal::parallel_for(list.edges.size(), threads, [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                list.edges[i] = { label[list.edges[i].first], label[list.edges[i].second] };
+            }
+        });
+
+        return list;
+    }
+
+    /**
+     * @brief Generates an Erdős–Rényi graph G(n, p), where every possible edge exists with probability `p`.
+     *
+     * Each row of the adjacency matrix jumps from edge to edge with geometrically distributed
+     * skips, so the time is proportional to the number of edges rather than `n^2`.
+     *
+     * @param vertices The number of vertices.
+     * @param probability The probability of every edge.
+     * @param directed True to draw every ordered pair, false to draw every unordered pair once as (u, v) with u < v.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @param seed The seed; the result does not depend on the number of threads.
+     * @return The vertices and edges, without self-loops or duplicates.
+     */
+    inline edge_list erdos_renyi_graph(size_t vertices, double probability, bool directed = false, size_t threads = 0, std::uint64_t seed = 0) {
+        edge_list list;
+        list.vertices = vertices;
+        if (probability <= 0.0)
+            return list;
+
+        const double log_q = std::log1p(-std::min(probability, 1.0));
+        list.edges = internal::generate_rows(vertices, threads, [&](size_t u, std::vector<std::pair<size_t, size_t>>& edges) {
+            // Directed rows skip the diagonal, undirected rows only cover the upper triangle
+            const size_t first = directed ? 0 : u + 1;
+            const size_t candidates = directed ? vertices - 1 : vertices - u - 1;
+            internal::counter_rng rng(seed, u);
+            for (size_t position = 0; ; ++position) {
+                if (probability < 1.0) {
+                    const double skip = std::floor(std::log1p(-rng.uniform()) / log_q);
+                    if (skip >= static_cast<double>(candidates - position))
+                        break;
+                    position += static_cast<size_t>(skip);
+                }
+                if (position >= candidates)
+                    break;
+
+                const size_t v = first + position;
+                edges.emplace_back(u, directed && v >= u ? v + 1 : v);
+            }
+        });
+
+        return list;
+    }
+
+    /**
+     * @brief Generates a Barabási–Albert graph by preferential attachment.
+     *
+     * Vertex 1, 2, ... joins the graph in turn and attaches `edges_per_vertex` edges to earlier
+     * vertices chosen with probability proportional to their degree. The edges are computed with
+     * the copy model of Batagelj and Brandes: the target of an edge copies an endpoint at a random
+     * earlier position of the edge list, which is recomputed instead of read, so every edge is
+     * generated independently and in parallel. The list has no self-loops but may hold
+     * duplicates.
+     *
+     * @param vertices The number of vertices.
+     * @param edges_per_vertex The number of edges each new vertex attaches.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @param seed The seed; the result does not depend on the number of threads.
+     * @return The vertices and `(vertices - 1) * edges_per_vertex` edges from each new vertex to earlier ones.
+     */
+    inline edge_list barabasi_albert_graph(size_t vertices, size_t edges_per_vertex, size_t threads = 0, std::uint64_t seed = 0) {
+        edge_list list;
+        list.vertices = vertices;
+        if (vertices < 2 || edges_per_vertex == 0)
+            return list;
+
+        // Position 2i of the virtual endpoint list is the source of edge i, position 2i + 1 its target
+        const size_t m = edges_per_vertex;
+        auto endpoint = [m, seed](size_t position) {
+            while (position % 2 == 1) {
+                // Any endpoint of the edges that were there before the vertex of this edge joined
+                const size_t joined = 2 * (position / 2 / m) * m;
+                if (joined == 0)
+                    return size_t{ 0 };
+
+                internal::counter_rng rng(seed, position);
+                position = static_cast<size_t>(rng.next() % joined);
+            }
+            return position / 2 / m + 1;
+        };
+
+        list.edges.resize((vertices - 1) * m);
+        internal::parallel_for(list.edges.size(), threads, [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                list.edges[i] = { i / m + 1, endpoint(2 * i + 1) };
+            }
+        });
+
+        return list;
+    }
+
+    /**
+     * @brief Generates a 2D or 3D grid graph.
+     *
+     * Vertex (x, y, z) has id `x + width * (y + height * z)` and an edge to the next vertex along
+     * every axis. With `periodic` the last vertex along an axis of at least three vertices also
+     * connects to the first, which makes a torus.
+     *
+     * @param width The number of vertices along x.
+     * @param height The number of vertices along y.
+     * @param depth The number of vertices along z; 1 for a 2D grid.
+     * @param periodic True to wrap around at the borders.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @return The vertices and edges, each from the lower to the higher id except for the wrap-around edges.
+     */
+    inline edge_list grid_graph(size_t width, size_t height, size_t depth = 1, bool periodic = false, size_t threads = 0) {
+        edge_list list;
+        list.vertices = width * height * depth;
+        const size_t extent[3] = { width, height, depth };
+        const size_t stride[3] = { 1, width, width * height };
+
+        list.edges = internal::generate_rows(height * depth, threads, [&](size_t row, std::vector<std::pair<size_t, size_t>>& edges) {
+            const size_t coordinates[3] = { 0, row % height, row / height };
+            for (size_t x = 0; x < width; ++x) {
+                const size_t u = row * width + x;
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    const size_t position = axis == 0 ? x : coordinates[axis];
+                    if (position + 1 < extent[axis])
+                        edges.emplace_back(u, u + stride[axis]);
+                    else if (periodic && extent[axis] > 2)
+                        edges.emplace_back(u, u - position * stride[axis]);
+                }
+            }
+        });
+
+        return list;
+    }
+
+    /**
+     * @brief Adds the vertices and edges of a generated graph to a directed graph in bulk.
+     */
+    template<typename T>
+    void add_edge_list(directed_graph<T>& graph, const edge_list& list) {
+        internal::add_edge_list<directed_graph<T>, T>(graph, list);
+    }
+
+    /**
+     * @brief Adds the vertices and edges of a generated graph to an undirected graph in bulk.
+     */
+    template<typename T>
+    void add_edge_list(undirected_graph<T>& graph, const edge_list& list) {
+        internal::add_edge_list<undirected_graph<T>, T>(graph, list);
+    }
+
+} // end of namespace grphx
@@ -1,124 +1,1365 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <mutex>
 #include <queue>
+#include <stack>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
 #include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+#if defined(GRPHX_ENABLE_INSTRUMENTATION)
+#define GRPHX_INSTRUMENT(operation) grphx::internal::operation_scope grphx_operation_scope_(this->m_instrumentation, operation)
+#define GRPHX_TOUCH(vertices, edges) grphx_operation_scope_.touch((vertices), (edges))
+#else
+#define GRPHX_INSTRUMENT(operation) ((void)0)
+#define GRPHX_TOUCH(vertices, edges) ((void)0)
+#endif
+
+namespace grphx {
+
+    template<typename T>
+    class csr_graph;
+
+    /**
+     * @brief Estimated heap footprint of a graph, in bytes.
+     */
+    struct memory_breakdown {
+        size_t vertex_table{ 0 }; ///< Storage of the vertex values.
+        size_t adjacency{ 0 };    ///< Storage of the neighbor entries and row offsets.
+        size_t indexes{ 0 };      ///< Lookup structures such as hash indexes.
+        size_t overhead{ 0 };     ///< Node links, container headers, unused capacity and allocator bookkeeping.
+
+        /**
+         * @brief Returns the sum of all categories.
+         */
+        size_t total() const {
+            return this->vertex_table + this->adjacency + this->indexes + this->overhead;
+        }
+    };
+
+    /**
+     * @brief Graph operations recorded by the instrumentation layer.
+     */
+    enum class graph_operation : size_t {
+        add_vertex,
+        add_edge,
+        remove_vertex,
+        remove_edge,
+        contains_vertex,
+        contains_edge,
+        in_degree,
+        out_degree,
+        degree,
+        successors,
+        predecessors,
+        neighbors,
+        bfs,
+        dfs,
+        count ///< Number of operations, not an operation itself.
+    };
+
+    /**
+     * @brief Returns the name of a graph operation, e.g. for exporting metrics.
+     */
+    inline const char* to_string(graph_operation operation) {
+        static const char* const names[] = {
+            "add_vertex", "add_edge", "remove_vertex", "remove_edge", "contains_vertex", "contains_edge",
+            "in_degree", "out_degree", "degree", "successors", "predecessors", "neighbors", "bfs", "dfs"
+        };
+        return operation < graph_operation::count ? names[static_cast<size_t>(operation)] : "unknown";
+    }
+
+    /**
+     * @brief A single recorded call of a graph operation.
+     */
+    struct operation_sample {
+        graph_operation operation;
+        std::chrono::nanoseconds latency;
+        size_t vertices_touched;
+        size_t edges_touched;
+    };
+
+    /**
+     * @brief Aggregated statistics of one graph operation.
+     */
+    struct operation_stats {
+        static constexpr size_t histogram_buckets = 40;
+
+        size_t calls{ 0 };
+        size_t vertices_touched{ 0 };
+        size_t edges_touched{ 0 };
+        std::chrono::nanoseconds total_latency{ 0 };
+        std::array<size_t, histogram_buckets> latency_histogram{}; ///< Bucket `i` counts calls that took [2^i, 2^(i+1)) ns.
+    };
+
+    /**
+     * @brief Callback invoked after every instrumented operation.
+     */
+    using instrumentation_hook = std::function<void(const operation_sample&)>;
+
+    /**
+     * @brief Per-operation statistics of a graph.
+     */
+    class graph_stats {
+    public:
+        /**
+         * @brief Returns the statistics of an operation.
+         */
+        const operation_stats& operator[](graph_operation operation) const {
+            return this->m_operations[static_cast<size_t>(operation)];
+        }
+
+        /**
+         * @brief Adds a sample to the statistics of its operation.
+         */
+        void record(const operation_sample& sample) {
+            auto& stats = this->m_operations[static_cast<size_t>(sample.operation)];
+            ++stats.calls;
+            stats.vertices_touched += sample.vertices_touched;
+            stats.edges_touched += sample.edges_touched;
+            stats.total_latency += sample.latency;
+
+            size_t bucket{ 0 };
+            for (auto ns = sample.latency.count(); ns > 1 && bucket + 1 < operation_stats::histogram_buckets; ns >>= 1) {
+                ++bucket;
+            }
+            ++stats.latency_histogram[bucket];
+        }
+
+        /**
+         * @brief Resets all statistics to zero.
+         */
+        void reset() {
+            this->m_operations.fill(operation_stats{});
+        }
+
+    private:
+        std::array<operation_stats, static_cast<size_t>(graph_operation::count)> m_operations{};
+    };
+
+    /**
+     * @brief Strategies used to relabel vertices for better memory locality.
+     */
+    enum class vertex_ordering {
+        degree,                 ///< Vertices sorted by descending degree, hubs first.
+        reverse_cuthill_mckee,  ///< Reverse Cuthill-McKee, minimizes the bandwidth of the adjacency matrix.
+        bfs                     ///< Breadth-first discovery order, one component after the other.
+    };
+
+    /**
+     * @brief How a graph treats an edge that is added more than once.
+     */
+    enum class edge_policy {
+        simple,     ///< Adding an existing edge has no effect.
+        multigraph  ///< Every call to `add_edge` stores a parallel edge.
+    };
+
+    /**
+     * @brief Receives the structural changes of a graph, e.g. to maintain derived data incrementally.
+     *
+     * Observers are attached with `add_observer` and are called after the change took effect.
+     * Every callback defaults to doing nothing.
+     */
+    template<typename T>
+    class graph_observer {
+    public:
+        virtual ~graph_observer() = default;
+
+        virtual void vertex_added(const T& v) { (void)v; }
+        virtual void edge_added(const T& u, const T& v) { (void)u; (void)v; }
+        virtual void vertex_removed(const T& v) { (void)v; }
+        virtual void edge_removed(const T& u, const T& v) { (void)u; (void)v; }
+        virtual void cleared() {}
+    };
+
+    namespace internal {
+
+        /**
+         * @brief Estimates the bytes a general purpose allocator hands out for a request of `bytes`.
+         * 
+         * Assumes one pointer of bookkeeping per block and blocks aligned to two pointers.
+         */
+        constexpr size_t allocation_size(size_t bytes) {
+            constexpr size_t alignment = 2 * sizeof(void*);
+            return (bytes + sizeof(void*) + alignment - 1) / alignment * alignment;
+        }
+
+        /**
+         * @brief Estimates the bytes allocated by a doubly linked list node holding a `value_size` payload.
+         */
+        constexpr size_t list_node_size(size_t value_size) {
+            return allocation_size(2 * sizeof(void*) + value_size);
+        }
+
+        /**
+         * @brief Estimates the bytes allocated by a node based hash table, excluding its header.
+         */
+        constexpr size_t hash_table_size(size_t bucket_count, size_t size, size_t value_size) {
+            return bucket_count * sizeof(void*) + size * allocation_size(sizeof(void*) + value_size + sizeof(size_t));
+        }
+
+        /**
+         * @brief Hashes an edge given as a (source, destination) pair.
+         */
+        template<typename T>
+        struct edge_hash {
+            size_t operator()(const std::pair<T, T>& edge) const {
+                const size_t h = std::hash<T>{}(edge.first);
+                return h ^ (std::hash<T>{}(edge.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+            }
+        };
+
+        /**
+         * @brief Statistics and export hook of an instrumented graph.
+         * 
+         * Const queries record here, so concurrent readers of one graph serialize on the mutex
+         * instead of racing on the counters.
+         */
+        struct instrumentation {
+            graph_stats stats;
+            instrumentation_hook hook;
+            std::mutex mutex;
+        };
+
+        /**
+         * @brief Times an operation and records it when the scope ends.
+         */
+        class operation_scope {
+        public:
+            operation_scope(instrumentation& target, graph_operation operation)
+                : m_target(target), m_sample{ operation, std::chrono::nanoseconds{ 0 }, 0, 0 }, m_start(std::chrono::steady_clock::now()) {}
+
+            ~operation_scope() {
+                this->m_sample.latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->m_start);
+                std::lock_guard<std::mutex> lock(this->m_target.mutex);
+                this->m_target.stats.record(this->m_sample);
+                if (this->m_target.hook) {
+                    this->m_target.hook(this->m_sample);
+                }
+            }
+
+            operation_scope(const operation_scope&) = delete;
+            operation_scope& operator=(const operation_scope&) = delete;
+
+            void touch(size_t vertices, size_t edges) {
+                this->m_sample.vertices_touched += vertices;
+                this->m_sample.edges_touched += edges;
+            }
+
+        private:
+            instrumentation& m_target;
+            operation_sample m_sample;
+            std::chrono::steady_clock::time_point m_start;
+        };
+
+        /**
+         * @brief Computes a new vertex order for a graph given in CSR form.
+         *
+         * @param offsets Row offsets, the neighbors of `i` are `targets[offsets[i]..offsets[i + 1])`.
+         * @param targets Concatenated neighbor ids.
+         * @param strategy The ordering strategy.
+         * @return The old id of every vertex, indexed by its new id.
+         */
+        inline std::vector<size_t> compute_ordering(const std::vector<size_t>& offsets, const std::vector<size_t>& targets, vertex_ordering strategy) {
+            const size_t count = offsets.empty() ? 0 : offsets.size() - 1;
+            auto degree = [&offsets](size_t v) { return offsets[v + 1] - offsets[v]; };
+
+            std::vector<size_t> order(count);
+            std::iota(order.begin(), order.end(), size_t{ 0 });
+
+            if (strategy == vertex_ordering::degree) {
+                std::stable_sort(order.begin(), order.end(), [&degree](size_t a, size_t b) {
+                    return degree(a) > degree(b);
+                });
+                return order;
+            }
+
+            // Both remaining strategies are breadth-first sweeps over every component. Reverse
+            // Cuthill-McKee starts each component at a minimum degree vertex and visits neighbors
+            // by increasing degree, plain BFS keeps the original order.
+            const bool rcm = strategy == vertex_ordering::reverse_cuthill_mckee;
+            std::vector<size_t> roots(order);
+            if (rcm) {
+                std::stable_sort(roots.begin(), roots.end(), [&degree](size_t a, size_t b) {
+                    return degree(a) < degree(b);
+                });
+            }
+
+            std::vector<bool> seen(count, false);
+            std::vector<size_t> neighbors;
+            order.clear();
+
+            for (size_t root : roots) {
+                if (seen[root])
+                    continue;
+
+                seen[root] = true;
+                size_t head = order.size();
+                order.push_back(root);
+
+                while (head < order.size()) {
+                    const size_t current = order[head++];
+                    neighbors.assign(targets.begin() + offsets[current], targets.begin() + offsets[current + 1]);
+                    if (rcm) {
+                        std::stable_sort(neighbors.begin(), neighbors.end(), [&degree](size_t a, size_t b) {
+                            return degree(a) < degree(b);
+                        });
+                    }
+
+                    for (size_t neighbor : neighbors) {
+                        if (!seen[neighbor]) {
+                            seen[neighbor] = true;
+                            order.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+
+            if (rcm) {
+                std::reverse(order.begin(), order.end());
+            }
+
+            return order;
+        }
+
+        template<typename T>
+        class basic_graph {
+        public:
+            using LinkedList = std::list<std::pair<T, std::list<T>>>;
+            using EdgeIndex = std::unordered_map<std::pair<T, T>, size_t, edge_hash<T>>;
+            using EdgeSet = std::unordered_set<std::pair<T, T>, edge_hash<T>>;
+
+            basic_graph() = default;
+
+            /**
+             * @brief Returns how the graph treats an edge that is added more than once.
+             */
+            edge_policy policy() const {
+                return this->m_policy;
+            }
+
+            /**
+             * @brief Checks if the graph keeps a hash index of its edges.
+             */
+            bool has_edge_index() const {
+                return this->m_edge_index_enabled;
+            }
+
+            /**
+             * @brief Enables or disables the edge hash index.
+             * 
+             * With the index `contains_edge` and the duplicate check of `add_edge` take constant
+             * time instead of scanning the neighbor list, which matters for high-degree vertices.
+             * Enabling it indexes the current edges; `T` must then be hashable with `std::hash`.
+             * 
+             * @param enabled True to build and maintain the index, false to drop it.
+             */
+            void set_edge_index(bool enabled) {
+                EdgeIndex().swap(this->m_edge_index);
+                this->m_edge_index_enabled = enabled;
+                if (!enabled)
+                    return;
+
+                for (const auto& pair : this->m_adjacency_list) {
+                    for (const auto& neighbor : pair.second) {
+                        if (this->is_live(pair.first, neighbor))
+                            ++this->m_edge_index[{ pair.first, neighbor }];
+                    }
+                }
+            }
+
+            /**
+             * @brief Checks if removals are recorded as tombstones instead of being swept out of the rows.
+             */
+            bool has_lazy_removal() const {
+                return this->m_lazy_removal;
+            }
+
+            /**
+             * @brief Enables or disables lazy removal.
+             * 
+             * Eagerly, `remove_vertex` sweeps every neighbor list for entries of the vertex and
+             * `remove_edge` scans the row of the source. Lazily, a removed vertex only loses its own
+             * row and is recorded as a dead target, and a removed edge is recorded as a dead pair
+             * (found in constant time with the edge index); every query skips the dead entries.
+             * The rows are compacted once the tombstones per vertex exceed the tombstone threshold,
+             * or when a dead vertex or edge is added again. Disabling lazy removal compacts.
+             * 
+             * @param enabled True to record removals as tombstones, false to remove eagerly.
+             */
+            void set_lazy_removal(bool enabled) {
+                this->m_lazy_removal = enabled;
+                if (!enabled)
+                    this->compact();
+            }
+
+            /**
+             * @brief Returns the number of dead vertices and edges per vertex of the graph.
+             */
+            double tombstone_ratio() const {
+                if (this->m_adjacency_list.empty())
+                    return 0.0;
+
+                return static_cast<double>(this->m_dead_vertices.size() + this->m_dead_edges.size()) / static_cast<double>(this->m_adjacency_list.size());
+            }
+
+            /**
+             * @brief Sets the tombstone ratio that triggers an automatic compaction under lazy removal.
+             * 
+             * @param ratio The tombstone threshold; 0 disables automatic compaction.
+             */
+            void set_tombstone_threshold(double ratio) {
+                this->m_tombstone_threshold = ratio;
+            }
+
+            /**
+             * @brief Sweeps the dead entries out of every row and clears all tombstones.
+             * 
+             * The vertices and edges of the graph do not change, so neither does its generation.
+             */
+            void compact() {
+                if (!this->has_tombstones())
+                    return;
+
+                for (auto& pair : this->m_adjacency_list) {
+                    const T& u = pair.first;
+                    pair.second.remove_if([this, &u](const T& v) {
+                        if (this->is_live(u, v))
+                            return false;
+
+                        this->unindex_edge(u, v);
+                        return true;
+                    });
+                }
+                std::unordered_set<T>().swap(this->m_dead_vertices);
+                EdgeSet().swap(this->m_dead_edges);
+            }
+            
+            /**
+             * @brief Checks if the graph contains a vertex.
+             * 
+             * @param v The vertex to check for.
+             * @return True if the vertex is found in the graph, false otherwise.
+             */
+            bool contains_vertex(T v) const {
+                GRPHX_INSTRUMENT(graph_operation::contains_vertex);
+                auto it = this->find_vertex(v);
+                GRPHX_TOUCH(this->scanned(it), 0);
+
+                return it != this->m_adjacency_list.end();
+            }
+
+            /**
+             * @brief Returns the number of vertices in the graph.
+             * 
+             * @return The number of vertices in the graph.
+             */
+            size_t size() const {
+                return this->m_adjacency_list.size();
+            }
+
+            /**
+             * @brief Checks if the graph is empty.
+             * 
+             * @return True if the graph is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return this->m_adjacency_list.empty();
+            }
+
+            /**
+             * @brief Clears the graph, removing all vertices and edges.
+             */
+            void clear() {
+                this->m_adjacency_list.clear();
+                this->m_edge_index.clear();
+                this->m_dead_vertices.clear();
+                this->m_dead_edges.clear();
+                this->m_vertex_slots.clear();
+                this->m_unslotted = 0;
+                this->modified();
+                for (auto* observer : this->m_observers) {
+                    observer->cleared();
+                }
+            }
+
+            /**
+             * @brief Attaches an observer that is told about every added and removed vertex and edge.
+             * 
+             * The graph does not own the observer, which must be removed before it is destroyed.
+             * 
+             * @param observer The observer.
+             */
+            void add_observer(graph_observer<T>* observer) {
+                this->m_observers.push_back(observer);
+            }
+
+            /**
+             * @brief Detaches an observer; this function has no effect if it is not attached.
+             * 
+             * @param observer The observer.
+             */
+            void remove_observer(graph_observer<T>* observer) {
+                this->m_observers.erase(std::remove(this->m_observers.begin(), this->m_observers.end(), observer), this->m_observers.end());
+            }
+
+            /**
+             * @brief Returns a counter that changes whenever the vertices or edges of the graph change.
+             * 
+             * Results derived from the graph, such as those held by a `query_cache`, stay valid as
+             * long as the generation they were computed at is current.
+             * 
+             * @return The current generation.
+             */
+            std::uint64_t generation() const {
+                return this->m_generation;
+            }
+
+            /**
+             * @brief Estimates the memory used by the graph.
+             * 
+             * @return The estimated heap and object footprint, broken down by purpose.
+             */
+            memory_breakdown memory_usage() const {
+                memory_breakdown usage;
+                size_t edges{ 0 };
+                for (const auto& pair : this->m_adjacency_list) {
+                    edges += pair.second.size();
+                }
+
+                const size_t vertices = this->m_adjacency_list.size();
+                usage.vertex_table = vertices * sizeof(T);
+                usage.adjacency = edges * sizeof(T);
+                if (this->m_edge_index_enabled)
+                    usage.indexes = internal::hash_table_size(this->m_edge_index.bucket_count(), this->m_edge_index.size(), sizeof(typename EdgeIndex::value_type));
+                usage.indexes += this->m_vertex_slots.capacity() * sizeof(typename LinkedList::iterator);
+                usage.indexes += internal::hash_table_size(this->m_dead_vertices.bucket_count(), this->m_dead_vertices.size(), sizeof(T))
+                    + internal::hash_table_size(this->m_dead_edges.bucket_count(), this->m_dead_edges.size(), sizeof(std::pair<T, T>));
+
+                usage.overhead = sizeof(*this)
+                    + vertices * (internal::list_node_size(sizeof(std::pair<T, std::list<T>>)) - sizeof(T))
+                    + edges * (internal::list_node_size(sizeof(T)) - sizeof(T));
+
+                return usage;
+            }
+
+            /**
+             * @brief Repacks the graph into freshly allocated storage.
+             * 
+             * Copies every vertex and neighbor entry into new nodes in their current order, which
+             * returns memory fragmented by bulk `remove_vertex`/`remove_edge` calls to the allocator
+             * and places the nodes of a vertex next to each other.
+             */
+            void shrink_to_fit() {
+                this->compact();
+                LinkedList packed;
+                for (const auto& pair : this->m_adjacency_list) {
+                    packed.emplace_back(pair.first, std::list<T>(pair.second.begin(), pair.second.end()));
+                }
+
+                this->m_adjacency_list.swap(packed);
+                this->rebuild_vertex_index();
+                this->m_vertex_slots.shrink_to_fit();
+                this->m_edge_index.rehash(0);
+            }
+
+            /**
+             * @brief Relabels the vertices to improve memory locality of traversals.
+             * 
+             * The adjacency list is rebuilt with the vertices in the order given by `strategy` and
+             * every neighbor list sorted by that order. Vertices keep their values, only their
+             * position in the graph changes.
+             * 
+             * @param strategy The ordering strategy.
+             */
+            void reorder(vertex_ordering strategy) {
+                this->compact();
+                std::unordered_map<T, size_t> position;
+                std::vector<const std::pair<T, std::list<T>>*> entries;
+                for (const auto& pair : this->m_adjacency_list) {
+                    position.emplace(pair.first, entries.size());
+                    entries.push_back(&pair);
+                }
+
+                std::vector<size_t> offsets{ 0 };
+                std::vector<size_t> targets;
+                for (const auto* entry : entries) {
+                    for (const auto& neighbor : entry->second) {
+                        auto it = position.find(neighbor);
+                        if (it != position.end()) {
+                            targets.push_back(it->second);
+                        }
+                    }
+                    offsets.push_back(targets.size());
+                }
+
+                const std::vector<size_t> order = internal::compute_ordering(offsets, targets, strategy);
+                std::vector<size_t> rank(order.size());
+                for (size_t i = 0; i < order.size(); ++i) {
+                    rank[order[i]] = i;
+                }
+
+                auto rank_of = [&position, &rank](const T& v) {
+                    auto it = position.find(v);
+                    return it != position.end() ? rank[it->second] : rank.size();
+                };
+
+                // Copy into freshly allocated nodes so that the new order is also the allocation order
+                LinkedList reordered;
+                for (size_t old_id : order) {
+                    std::vector<T> neighbors(entries[old_id]->second.begin(), entries[old_id]->second.end());
+                    std::stable_sort(neighbors.begin(), neighbors.end(), [&rank_of](const T& a, const T& b) {
+                        return rank_of(a) < rank_of(b);
+                    });
+                    reordered.emplace_back(entries[old_id]->first, std::list<T>(neighbors.begin(), neighbors.end()));
+                }
+
+                this->m_adjacency_list.swap(reordered);
+                this->rebuild_vertex_index();
+                this->modified();
+            }
+
+            /**
+             * @brief Breadth-First Search (BFS) algorithm.
+             * 
+             * @param start The starting vertex for BFS traversal.
+             * @return A vector containing the vertices visited during BFS traversal.
+             */
+            std::vector<T> bfs(T start) const {
+                GRPHX_INSTRUMENT(graph_operation::bfs);
+                std::vector<T> visited;
+                std::queue<T> queue;
+                std::unordered_set<T> seen;
+                
+                queue.push(start);
+                seen.insert(start);
+                
+                while (!queue.empty()) {
+                    T current = queue.front();
+                    queue.pop();
+                    visited.push_back(current);
+                    
+                    const std::list<T> successors = this->successors(current);
+                    GRPHX_TOUCH(1, successors.size());
+                    for (const auto& neighbor : successors) {
+                        if (seen.find(neighbor) == seen.end()) {
+                            queue.push(neighbor);
+                            seen.insert(neighbor);
+                        }
+                    }
+                }
+                
+                return visited;
+            }
+
+            /**
+             * @brief Depth-First Search (DFS) algorithm.
+             * 
+             * @param start The starting vertex for DFS traversal.
+             * @return A vector containing the vertices visited during DFS traversal.
+             */
+            std::vector<T> dfs(T start) const {
+                GRPHX_INSTRUMENT(graph_operation::dfs);
+                std::vector<T> visited;
+                std::stack<T> stack;
+                std::unordered_set<T> seen;
+                
+                stack.push(start);
+                
+                while (!stack.empty()) {
+                    T current = stack.top();
+                    stack.pop();
+                    
+                    if (seen.find(current) == seen.end()) {
+                        visited.push_back(current);
+                        seen.insert(current);
+                        
+                        const std::list<T> successors = this->successors(current);
+                        GRPHX_TOUCH(1, successors.size());
+                        for (const auto& neighbor : successors) {
+                            if (seen.find(neighbor) == seen.end()) {
+                                stack.push(neighbor);
+                            }
+                        }
+                    }
+                }
+                
+                return visited;
+            }
+
+            /**
+             * @brief Finds a shortest path, counted in edges, between two vertices.
+             * 
+             * Runs a bidirectional Breadth-First Search: one search follows the edges forward from
+             * `source`, the other follows them backward from `target`, and the frontier with fewer
+             * edges to follow is expanded one level at a time until the searches meet. Directed
+             * graphs do not store predecessors, so the first backward level builds a reverse index
+             * in one sweep; until then a backward level is charged as if it swept every vertex.
+             * 
+             * @param source The first vertex of the path.
+             * @param target The last vertex of the path.
+             * @return The vertices of the path from `source` to `target`, or an empty vector if `target` is unreachable.
+             */
+            std::vector<T> shortest_path(T source, T target) const {
+                std::vector<T> path;
+                this->shortest_path_until(source, target, path, []() { return false; });
+                return path;
+            }
+
+            /**
+             * @brief Finds a shortest path like `shortest_path`, but gives up when `stop()` returns true.
+             * 
+             * `stop` is called before every level of the search, so a long search can be cancelled
+             * or bounded in time; see `shortest_path_async`.
+             * 
+             * @param source The first vertex of the path.
+             * @param target The last vertex of the path.
+             * @param path Receives the vertices of the path, or nothing if `target` is unreachable or the search stopped.
+             * @param stop Callable `bool()` polled between levels.
+             * @return False if the search was stopped before it finished, true otherwise.
+             */
+            template<typename Stop>
+            bool shortest_path_until(T source, T target, std::vector<T>& path, Stop&& stop) const {
+                path.clear();
+                if (!this->contains_vertex(source) || !this->contains_vertex(target))
+                    return true;
+
+                if (source == target) {
+                    path.push_back(source);
+                    return true;
+                }
+
+                // Every reached vertex maps to its neighbor towards the origin of the search and its distance to it
+                std::unordered_map<T, std::pair<T, size_t>> forward_parent{ { source, { source, 0 } } };
+                std::unordered_map<T, std::pair<T, size_t>> backward_parent{ { target, { target, 0 } } };
+                std::vector<T> forward_frontier{ source };
+                std::vector<T> backward_frontier{ target };
+                std::vector<T> next;
+
+                size_t best_length = std::numeric_limits<size_t>::max();
+                T meeting = source;
+                auto meet = [&forward_parent, &backward_parent, &best_length, &meeting](const T& v) {
+                    auto forward = forward_parent.find(v);
+                    auto backward = backward_parent.find(v);
+                    if (forward != forward_parent.end() && backward != backward_parent.end()
+                        && forward->second.second + backward->second.second < best_length) {
+                        best_length = forward->second.second + backward->second.second;
+                        meeting = v;
+                    }
+                };
+
+                // Undirected rows already list the predecessors. Directed graphs build a reverse index
+                // the first time the backward side is cheaper even after paying for that sweep.
+                const bool symmetric = this->is_symmetric();
+                std::unordered_map<T, std::vector<T>> reverse;
+                bool reversed = false;
+                // Directed edges may point at values that are not vertices; those have no row
+                static const std::list<T> no_row;
+                auto out_row = [this](const T& v) -> const std::list<T>& {
+                    auto it = this->find_vertex(v);
+                    return it != this->m_adjacency_list.end() ? it->second : no_row;
+                };
+                auto frontier_cost = [&](const std::vector<T>& frontier, bool backward) {
+                    if (backward && !symmetric && !reversed)
+                        return this->size();
+                    size_t cost{ 0 };
+                    for (const T& v : frontier) {
+                        if (backward && !symmetric) {
+                            auto it = reverse.find(v);
+                            cost += it != reverse.end() ? it->second.size() : 0;
+                        }
+                        else {
+                            cost += this->live_size(v, out_row(v));
+                        }
+                    }
+                    return cost;
+                };
+
+                while (best_length == std::numeric_limits<size_t>::max() && !forward_frontier.empty() && !backward_frontier.empty()) {
+                    if (stop())
+                        return false;
+
+                    next.clear();
+                    if (frontier_cost(forward_frontier, false) <= frontier_cost(backward_frontier, true)) {
+                        for (const T& u : forward_frontier) {
+                            const size_t depth = forward_parent.at(u).second + 1;
+                            for (const T& w : out_row(u)) {
+                                if (!this->is_live(u, w))
+                                    continue;
+                                if (forward_parent.emplace(w, std::make_pair(u, depth)).second) {
+                                    next.push_back(w);
+                                    meet(w);
+                                }
+                            }
+                        }
+                        forward_frontier.swap(next);
+                        continue;
+                    }
+
+                    if (!symmetric && !reversed) {
+                        for (const auto& pair : this->m_adjacency_list) {
+                            for (const T& w : pair.second) {
+                                if (this->is_live(pair.first, w))
+                                    reverse[w].push_back(pair.first);
+                            }
+                        }
+                        reversed = true;
+                    }
+
+                    for (const T& w : backward_frontier) {
+                        const size_t depth = backward_parent.at(w).second + 1;
+                        auto expand = [&](const T& u) {
+                            if (backward_parent.emplace(u, std::make_pair(w, depth)).second) {
+                                next.push_back(u);
+                                meet(u);
+                            }
+                        };
+                        if (symmetric) {
+                            for (const T& u : out_row(w)) {
+                                if (this->is_live(w, u))
+                                    expand(u);
+                            }
+                        }
+                        else {
+                            auto it = reverse.find(w);
+                            if (it != reverse.end()) {
+                                for (const T& u : it->second) {
+                                    expand(u);
+                                }
+                            }
+                        }
+                    }
+                    backward_frontier.swap(next);
+                }
+
+                if (best_length == std::numeric_limits<size_t>::max())
+                    return true;
+
+                for (T v = meeting; !(v == source); v = forward_parent.at(v).first) {
+                    path.push_back(v);
+                }
+                path.push_back(source);
+                std::reverse(path.begin(), path.end());
+
+                for (T v = meeting; !(v == target);) {
+                    v = backward_parent.at(v).first;
+                    path.push_back(v);
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Adds many vertices at once.
+             * 
+             * Behaves like calling `add_vertex` for every vertex, but looks the vertices up through
+             * a hash map built once for the batch instead of scanning the graph for each of them.
+             * 
+             * @param first The first vertex.
+             * @param last Past the last vertex.
+             */
+            template<typename Iterator>
+            void add_vertices(Iterator first, Iterator last) {
+                batch_lookup lookup(*this);
+                bool changed = false;
+                for (; first != last; ++first) {
+                    const T v(*first);
+                    changed = lookup.insert(v).second || changed;
+                }
+                if (changed)
+                    this->modified();
+            }
+
+            /**
+             * @brief Adds many vertices at once.
+             * 
+             * @param vertices The vertices to add; existing vertices are skipped.
+             */
+            void add_vertices(const std::vector<T>& vertices) {
+                this->add_vertices(vertices.begin(), vertices.end());
+            }
+
+            virtual void add_vertex(T v) = 0;
+            virtual void add_edge(T u, T v) = 0;
+            virtual void remove_vertex(T v) = 0;
+            virtual void remove_edge(T u, T v) = 0;
+            virtual bool contains_edge(T u, T v) const = 0;
+            virtual std::list<T> successors(T v) const = 0;
+
+            /**
+             * @brief Returns the statistics recorded by the instrumentation layer.
+             * 
+             * Recording is serialized by a mutex, so the graph may be queried from several threads
+             * and the statistics read at the same time; the result is a consistent snapshot.
+             * 
+             * @return The per-operation statistics; all zero unless `GRPHX_ENABLE_INSTRUMENTATION` is defined.
+             */
+            graph_stats stats() const {
+#if defined(GRPHX_ENABLE_INSTRUMENTATION)
+                std::lock_guard<std::mutex> lock(this->m_instrumentation.mutex);
+                return this->m_instrumentation.stats;
+#else
+                return graph_stats();
+#endif
+            }
+
+            /**
+             * @brief Resets the statistics recorded by the instrumentation layer.
+             */
+            void reset_stats() {
+#if defined(GRPHX_ENABLE_INSTRUMENTATION)
+                std::lock_guard<std::mutex> lock(this->m_instrumentation.mutex);
+                this->m_instrumentation.stats.reset();
+#endif
+            }
+
+            /**
+             * @brief Sets a callback that receives every recorded operation, e.g. to export metrics.
+             * 
+             * The hook is called under the lock that serializes recording, so it never runs
+             * concurrently with itself even when the graph is read from several threads.
+             * 
+             * @param hook The callback; it is never called unless `GRPHX_ENABLE_INSTRUMENTATION` is defined.
+             */
+            void set_instrumentation_hook(instrumentation_hook hook) {
+#if defined(GRPHX_ENABLE_INSTRUMENTATION)
+                std::lock_guard<std::mutex> lock(this->m_instrumentation.mutex);
+                this->m_instrumentation.hook = std::move(hook);
+#else
+                (void)hook;
+#endif
+            }
+
+        protected:
+            /**
+             * @brief Creates an empty graph with the given edge policy.
+             */
+            basic_graph(edge_policy policy, bool index_edges) : m_policy(policy), m_edge_index_enabled(index_edges) {}
+
+            /**
+             * @brief Checks if the list `neighbors` of vertex `u` already holds an edge to `v`, using the index when enabled.
+             */
+            bool has_edge(const T& u, const std::list<T>& neighbors, const T& v) const {
+                if (!this->is_live(u, v))
+                    return false;
+                if (this->m_edge_index_enabled)
+                    return this->m_edge_index.find({ u, v }) != this->m_edge_index.end();
+
+                return std::find(neighbors.begin(), neighbors.end(), v) != neighbors.end();
+            }
+
+            /**
+             * @brief Checks if any removal is still recorded as a tombstone.
+             */
+            bool has_tombstones() const {
+                return !this->m_dead_vertices.empty() || !this->m_dead_edges.empty();
+            }
+
+            /**
+             * @brief Checks if an entry `v` in the row of `u` is neither a removed vertex nor a removed edge.
+             */
+            bool is_live(const T& u, const T& v) const {
+                if (!this->has_tombstones())
+                    return true;
+
+                return this->m_dead_vertices.find(v) == this->m_dead_vertices.end()
+                    && this->m_dead_edges.find({ u, v }) == this->m_dead_edges.end();
+            }
+
+            /**
+             * @brief Returns the number of live entries in the row `neighbors` of vertex `u`.
+             */
+            size_t live_size(const T& u, const std::list<T>& neighbors) const {
+                if (!this->has_tombstones())
+                    return neighbors.size();
+
+                return static_cast<size_t>(std::count_if(neighbors.begin(), neighbors.end(), [this, &u](const T& v) {
+                    return this->is_live(u, v);
+                }));
+            }
+
+            /**
+             * @brief Copies the live entries of the row `neighbors` of vertex `u`.
+             */
+            std::list<T> live_row(const T& u, const std::list<T>& neighbors) const {
+                if (!this->has_tombstones())
+                    return neighbors;
+
+                std::list<T> row;
+                for (const auto& v : neighbors) {
+                    if (this->is_live(u, v))
+                        row.push_back(v);
+                }
+                return row;
+            }
+
+            /**
+             * @brief Lifts the tombstones in the way of adding the edge from `u` to `v`, or the vertex `u` when both are equal.
+             * 
+             * The dead entries of a removed vertex are spread over all rows, so adding it again
+             * compacts the graph; a removed edge only has to be swept out of its own rows.
+             */
+            void revive(const T& u, const T& v) {
+                if (!this->has_tombstones())
+                    return;
+
+                if (this->m_dead_vertices.count(u) > 0 || this->m_dead_vertices.count(v) > 0) {
+                    this->compact();
+                    return;
+                }
+
+                this->purge_edge(u, v);
+                this->purge_edge(v, u);
+            }
+
+            /**
+             * @brief Removes the row of a vertex and records it as a dead target of the other rows.
+             */
+            void tombstone_vertex(typename LinkedList::iterator entry) {
+                const T v = entry->first;
+                if (this->m_edge_index_enabled) {
+                    for (const auto& neighbor : entry->second) {
+                        this->unindex_edge(v, neighbor);
+                        if (this->is_symmetric())
+                            this->unindex_edge(neighbor, v);
+                    }
+                }
+                this->unindex_vertex(v);
+                this->m_adjacency_list.erase(entry);
+                this->m_dead_vertices.insert(v);
+            }
 
-namespace grphx {
+            /**
+             * @brief Records the edge from `u` to `v` as removed.
+             */
+            void tombstone_edge(const T& u, const T& v) {
+                this->m_dead_edges.insert({ u, v });
+                this->unindex_edge(u, v);
+            }
 
-    namespace internal {
+            /**
+             * @brief Compacts the graph if the tombstones exceed the threshold.
+             */
+            void maybe_compact() {
+                const size_t vertices = std::max(this->m_adjacency_list.size(), minimum_compaction_size);
+                const size_t tombstones = this->m_dead_vertices.size() + this->m_dead_edges.size();
+                if (this->m_tombstone_threshold > 0.0
+                    && static_cast<double>(tombstones) > this->m_tombstone_threshold * static_cast<double>(vertices)) {
+                    this->compact();
+                }
+            }
 
-        template<typename T>
-        class basic_graph {
-        public:
-            using LinkedList = std::list<std::pair<T, std::list<T>>>;
-            
             /**
-             * @brief Checks if the graph contains a vertex.
-             * 
-             * @param v The vertex to check for.
-             * @return True if the vertex is found in the graph, false otherwise.
+             * @brief Records an added edge in the index.
              */
-            bool contains_vertex(T v) const {
-                return std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                    return pair.first == v;
-                }) != this->m_adjacency_list.end();
+            void index_edge(const T& u, const T& v) {
+                if (this->m_edge_index_enabled) {
+                    ++this->m_edge_index[{ u, v }];
+                }
             }
 
             /**
-             * @brief Returns the number of vertices in the graph.
-             * 
-             * @return The number of vertices in the graph.
+             * @brief Removes all parallel copies of an edge from the index.
              */
-            size_t size() const {
-                return this->m_adjacency_list.size();
+            void unindex_edge(const T& u, const T& v) {
+                if (this->m_edge_index_enabled) {
+                    this->m_edge_index.erase({ u, v });
+                }
             }
 
             /**
-             * @brief Checks if the graph is empty.
-             * 
-             * @return True if the graph is empty, false otherwise.
+             * @brief Checks if every edge is stored in both rows, so that the rows also list the predecessors.
              */
-            bool is_empty() const {
-                return this->m_adjacency_list.empty();
+            virtual bool is_symmetric() const {
+                return false;
             }
 
             /**
-             * @brief Clears the graph, removing all vertices and edges.
+             * @brief Starts a new generation after a change of the vertices or edges.
              */
-            void clear() {
-                this->m_adjacency_list.clear();
+            void modified() {
+                ++this->m_generation;
             }
 
             /**
-             * @brief Breadth-First Search (BFS) algorithm.
+             * @brief Calls `notify(observer)` for every attached observer.
+             */
+            template<typename Notify>
+            void notify(Notify&& notify) {
+                for (auto* observer : this->m_observers) {
+                    notify(*observer);
+                }
+            }
+
+            /**
+             * @brief Finds the entries of the vertices of a batch of insertions.
              * 
-             * @param start The starting vertex for BFS traversal.
-             * @return A vector containing the vertices visited during BFS traversal.
+             * Integral vertices are found through the slot table; other vertices through a hash map
+             * filled once per batch, which replaces a linear scan per lookup.
              */
-            std::vector<T> bfs(T start) const {
-                std::vector<T> visited;
-                std::queue<T> queue;
-                std::unordered_set<T> seen;
-                
-                queue.push(start);
-                seen.insert(start);
-                
-                while (!queue.empty()) {
-                    T current = queue.front();
-                    queue.pop();
-                    visited.push_back(current);
-                    
-                    for (const auto& neighbor : this->successors(current)) {
-                        if (seen.find(neighbor) == seen.end()) {
-                            queue.push(neighbor);
-                            seen.insert(neighbor);
-                        }
+            class batch_lookup {
+            public:
+                explicit batch_lookup(basic_graph& graph) : m_graph(graph) {}
+
+                /**
+                 * @brief Returns the entry of a vertex, or the end of the adjacency list if it is not in the graph.
+                 */
+                typename LinkedList::iterator find(const T& v) {
+                    // Vertices beyond the slot table would fall back to a linear scan
+                    if (!this->m_hashed && (!direct_indexed || this->m_graph.m_unslotted > 0))
+                        this->hash_entries();
+                    if (!this->m_hashed)
+                        return this->m_graph.find_vertex(v);
+
+                    auto it = this->m_entries.find(v);
+                    return it != this->m_entries.end() ? it->second : this->m_graph.m_adjacency_list.end();
+                }
+
+                /**
+                 * @brief Returns the entry of a vertex, adding the vertex first if needed.
+                 * 
+                 * @return The entry and whether the vertex was added.
+                 */
+                std::pair<typename LinkedList::iterator, bool> insert(const T& v) {
+                    auto it = this->find(v);
+                    if (it != this->m_graph.m_adjacency_list.end())
+                        return { it, false };
+
+                    this->m_graph.revive(v, v);
+                    this->m_graph.m_adjacency_list.emplace_back(v, std::list<T>());
+                    it = std::prev(this->m_graph.m_adjacency_list.end());
+                    this->m_graph.index_vertex(it);
+                    if (this->m_hashed)
+                        this->m_entries.emplace(v, it);
+                    this->m_graph.notify([&v](graph_observer<T>& observer) { observer.vertex_added(v); });
+                    return { it, true };
+                }
+
+            private:
+                void hash_entries() {
+                    auto& list = this->m_graph.m_adjacency_list;
+                    this->m_entries.reserve(list.size());
+                    for (auto it = list.begin(); it != list.end(); ++it) {
+                        this->m_entries.emplace(it->first, it);
                     }
+                    this->m_hashed = true;
                 }
-                
-                return visited;
-            }
+
+                basic_graph& m_graph;
+                std::unordered_map<T, typename LinkedList::iterator> m_entries;
+                bool m_hashed{ false };
+            };
 
             /**
-             * @brief Depth-First Search (DFS) algorithm.
+             * @brief Runs `insert(lookup, u, v)` for a batch of edges and starts one generation if any of them changed the graph.
              * 
-             * @param start The starting vertex for DFS traversal.
-             * @return A vector containing the vertices visited during DFS traversal.
+             * Without an edge index, the duplicate check of the `simple` policy scans a neighbor
+             * list per edge, so a large batch is checked through an index that is dropped again at
+             * the end.
              */
-            std::vector<T> dfs(T start) const {
-                std::vector<T> visited;
-                std::stack<T> stack;
-                std::unordered_set<T> seen;
-                
-                stack.push(start);
-                
-                while (!stack.empty()) {
-                    T current = stack.top();
-                    stack.pop();
-                    
-                    if (seen.find(current) == seen.end()) {
-                        visited.push_back(current);
-                        seen.insert(current);
-                        
-                        for (const auto& neighbor : this->successors(current)) {
-                            if (seen.find(neighbor) == seen.end()) {
-                                stack.push(neighbor);
-                            }
+            template<typename Iterator, typename Insert>
+            void insert_edges(Iterator first, Iterator last, Insert&& insert) {
+                static_assert(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                              "add_edges needs forward iterators, the batch is measured before it is inserted");
+                const bool temporary_index = this->m_policy == edge_policy::simple && !this->m_edge_index_enabled
+                    && static_cast<size_t>(std::distance(first, last)) > 64;
+                if (temporary_index)
+                    this->set_edge_index(true);
+
+                batch_lookup lookup(*this);
+                bool changed = false;
+                for (; first != last; ++first) {
+                    const T u(first->first);
+                    const T v(first->second);
+                    changed = insert(lookup, u, v) || changed;
+                }
+
+                if (temporary_index)
+                    this->set_edge_index(false);
+                if (changed)
+                    this->modified();
+            }
+
+            /**
+             * @brief Finds the entry of a vertex, directly through the slot table when possible.
+             */
+            typename LinkedList::iterator find_vertex(const T& v) {
+                if constexpr (direct_indexed) {
+                    const size_t slot = slot_of(v);
+                    if (slot < this->m_vertex_slots.size())
+                        return this->m_vertex_slots[slot];
+                    if (this->m_unslotted == 0)
+                        return this->m_adjacency_list.end();
+                }
+
+                return std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
+                    return pair.first == v;
+                });
+            }
+
+            /**
+             * @brief Finds the entry of a vertex, directly through the slot table when possible.
+             */
+            typename LinkedList::const_iterator find_vertex(const T& v) const {
+                return const_cast<basic_graph*>(this)->find_vertex(v);
+            }
+
+            /**
+             * @brief Records the slot of a vertex that was just appended to the adjacency list.
+             */
+            void index_vertex(typename LinkedList::iterator it) {
+                if constexpr (direct_indexed) {
+                    const size_t slot = slot_of(it->first);
+                    if (slot >= this->m_vertex_slots.size() && slot < this->slot_limit()) {
+                        this->m_vertex_slots.resize(std::min(std::max(slot + 1, 2 * this->m_vertex_slots.size()), this->slot_limit()), this->m_adjacency_list.end());
+                        // Vertices that were out of range before may fit now
+                        if (this->m_unslotted > 0) {
+                            this->rebuild_vertex_index();
+                            return;
                         }
                     }
+
+                    if (slot < this->m_vertex_slots.size())
+                        this->m_vertex_slots[slot] = it;
+                    else
+                        ++this->m_unslotted;
+                }
+                else {
+                    (void)it;
                 }
-                
-                return visited;
             }
 
-            virtual void add_vertex(T v) = 0;
-            virtual void add_edge(T u, T v) = 0;
-            virtual void remove_vertex(T v) = 0;
-            virtual void remove_edge(T u, T v) = 0;
-            virtual bool contains_edge(T u, T v) const = 0;
+            /**
+             * @brief Forgets the slot of a vertex that is about to be erased.
+             */
+            void unindex_vertex(const T& v) {
+                if constexpr (direct_indexed) {
+                    const size_t slot = slot_of(v);
+                    if (slot < this->m_vertex_slots.size())
+                        this->m_vertex_slots[slot] = this->m_adjacency_list.end();
+                    else
+                        --this->m_unslotted;
+                }
+                else {
+                    (void)v;
+                }
+            }
+
+            /**
+             * @brief Rebuilds the slot table after the adjacency list was replaced.
+             */
+            void rebuild_vertex_index() {
+                if constexpr (direct_indexed) {
+                    size_t slots{ 0 };
+                    for (const auto& pair : this->m_adjacency_list) {
+                        const size_t slot = slot_of(pair.first);
+                        if (slot < this->slot_limit())
+                            slots = std::max(slots, slot + 1);
+                    }
+
+                    this->m_vertex_slots.assign(slots, this->m_adjacency_list.end());
+                    this->m_unslotted = 0;
+                    for (auto it = this->m_adjacency_list.begin(); it != this->m_adjacency_list.end(); ++it) {
+                        const size_t slot = slot_of(it->first);
+                        if (slot < slots)
+                            this->m_vertex_slots[slot] = it;
+                        else
+                            ++this->m_unslotted;
+                    }
+                }
+            }
+
+            /**
+             * @brief Returns the number of vertices a linear search inspected to stop at `it`.
+             */
+            size_t scanned(typename LinkedList::const_iterator it) const {
+                if constexpr (direct_indexed) {
+                    if (it != this->m_adjacency_list.cend() && slot_of(it->first) < this->m_vertex_slots.size())
+                        return 1;
+                }
+
+                const size_t position = static_cast<size_t>(std::distance(this->m_adjacency_list.cbegin(), it));
+                return it != this->m_adjacency_list.cend() ? position + 1 : position;
+            }
 
-        protected:
             LinkedList m_adjacency_list;
+            EdgeIndex m_edge_index;
+            edge_policy m_policy{ edge_policy::simple };
+            bool m_edge_index_enabled{ false };
+            std::uint64_t m_generation{ 0 };
+            std::vector<typename LinkedList::iterator> m_vertex_slots;
+            size_t m_unslotted{ 0 };
+            std::vector<graph_observer<T>*> m_observers;
+            bool m_lazy_removal{ false };
+            std::unordered_set<T> m_dead_vertices;
+            EdgeSet m_dead_edges;
+            double m_tombstone_threshold{ 0.5 };
+
+#if defined(GRPHX_ENABLE_INSTRUMENTATION)
+            mutable internal::instrumentation m_instrumentation;
+#endif
+
+        private:
+            friend class csr_graph<T>;
+
+            /**
+             * @brief Integral vertices are looked up by value in a slot table instead of a linear scan.
+             */
+            static constexpr bool direct_indexed = std::is_integral<T>::value && !std::is_same<T, bool>::value;
+
+            /**
+             * @brief Small graphs are compared against this many vertices, so that they do not compact on every removal.
+             */
+            static constexpr size_t minimum_compaction_size = 64;
+
+            /**
+             * @brief Sweeps a removed edge out of the row of its source and lifts its tombstone.
+             */
+            void purge_edge(const T& u, const T& v) {
+                if (this->m_dead_edges.erase({ u, v }) == 0)
+                    return;
+
+                auto it = this->find_vertex(u);
+                if (it != this->m_adjacency_list.end())
+                    it->second.remove(v);
+            }
+
+            /**
+             * @brief Returns the slot of an integral vertex, or a value past every table for negative vertices.
+             */
+            static size_t slot_of(const T& v) {
+                if constexpr (direct_indexed) {
+                    if constexpr (std::is_signed<T>::value) {
+                        if (v < 0)
+                            return std::numeric_limits<size_t>::max();
+                    }
+                    return static_cast<size_t>(v);
+                }
+                else {
+                    (void)v;
+                    return std::numeric_limits<size_t>::max();
+                }
+            }
+
+            /**
+             * @brief Returns the largest slot table size; vertices beyond it are found by a linear scan.
+             *
+             * Bounding the table by the vertex count keeps a few huge ids from allocating a huge table.
+             */
+            size_t slot_limit() const {
+                return std::max<size_t>(1024, 4 * this->m_adjacency_list.size());
+            }
         };
 
     } // end of namespace internal
@@ -129,6 +1370,14 @@ namespace grphx {
         directed_graph() = default;
         virtual ~directed_graph() = default;
 
+        /**
+         * @brief Creates an empty graph with an explicit edge policy.
+         * 
+         * @param policy Whether adding an existing edge is ignored or stores a parallel edge.
+         * @param index_edges True to maintain an edge hash index, see `set_edge_index`.
+         */
+        explicit directed_graph(edge_policy policy, bool index_edges = false) : internal::basic_graph<T>(policy, index_edges) {}
+
         directed_graph(const directed_graph&) = delete;
         directed_graph(directed_graph&&) = delete;
         directed_graph& operator=(const directed_graph&) = delete;
@@ -142,34 +1391,80 @@ namespace grphx {
          * @param v The vertex to add to the graph.
          */
         void add_vertex(T v) override {
+            GRPHX_INSTRUMENT(graph_operation::add_vertex);
             if (!this->contains_vertex(v)) {
+                this->revive(v, v);
                 this->m_adjacency_list.emplace_back(v, std::list<T>());
+                this->index_vertex(std::prev(this->m_adjacency_list.end()));
+                this->modified();
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_added(v); });
             }
         }
 
         /**
          * @brief Adds a new directed edge from vertex `u` to vertex `v` in the graph.
          * 
-         * If either of the vertices does not exist in the graph, it will be added.
+         * If the source vertex does not exist in the graph, this function has no effect. With the
+         * `simple` policy, the default, adding an existing edge has no effect either.
          * 
          * @param u The source vertex of the directed edge.
          * @param v The destination vertex of the directed edge.
          * @note This function adds a directed edge from vertex `u` to vertex `v`.
          */
         void add_edge(T u, T v) override {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::add_edge);
+            auto it = this->find_vertex(u);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
 
             if (it == this->m_adjacency_list.end())
                 return; // vertex u not found in graph
 
             // Add edge from u to v
-            if (std::find(it->second.begin(), it->second.end(), v) == it->second.end()) {
+            this->revive(u, v);
+            if (this->m_policy == edge_policy::multigraph || !this->has_edge(u, it->second, v)) {
                 it->second.push_back(v);
+                this->index_edge(u, v);
+                this->modified();
+                this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_added(u, v); });
             }
         }
 
+        /**
+         * @brief Adds many directed edges at once.
+         * 
+         * Behaves like calling `add_edge` for every edge in order, so edges whose source vertex is
+         * not in the graph are skipped, but finds the vertices through a lookup built once for the
+         * batch and starts a single generation.
+         * 
+         * @param first The first edge, a forward iterator to a pair of values convertible to `T`.
+         * @param last Past the last edge.
+         */
+        template<typename Iterator>
+        void add_edges(Iterator first, Iterator last) {
+            this->insert_edges(first, last, [this](typename internal::basic_graph<T>::batch_lookup& lookup, const T& u, const T& v) {
+                auto it = lookup.find(u);
+                if (it == this->m_adjacency_list.end())
+                    return false;
+                this->revive(u, v);
+                if (this->m_policy == edge_policy::simple && this->has_edge(u, it->second, v))
+                    return false;
+
+                it->second.push_back(v);
+                this->index_edge(u, v);
+                this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_added(u, v); });
+                return true;
+            });
+        }
+
+        /**
+         * @brief Adds many directed edges at once.
+         * 
+         * @param edges The edges as (source, destination) pairs.
+         */
+        void add_edges(const std::vector<std::pair<T, T>>& edges) {
+            this->add_edges(edges.begin(), edges.end());
+        }
+
         /**
          * @brief Removes a vertex from the graph.
          * 
@@ -178,15 +1473,43 @@ namespace grphx {
          * @param v The vertex to remove from the graph.
          */
         void remove_vertex(T v) override {
-            auto it = std::remove_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(),
-                                     [&v](const std::pair<T, std::list<T>>& pair) {
-                                         return pair.first == v;
-                                     });
-            this->m_adjacency_list.erase(it, this->m_adjacency_list.end());
+            GRPHX_INSTRUMENT(graph_operation::remove_vertex);
+            bool removed = false;
+            auto entry = this->find_vertex(v);
+            if (this->m_lazy_removal && entry != this->m_adjacency_list.end()) {
+                this->tombstone_vertex(entry);
+                this->modified();
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_removed(v); });
+                this->maybe_compact();
+                return;
+            }
+
+            if (entry != this->m_adjacency_list.end()) {
+                if (this->m_edge_index_enabled) {
+                    for (const auto& neighbor : entry->second) {
+                        this->unindex_edge(v, neighbor);
+                    }
+                }
+                this->unindex_vertex(v);
+                this->m_adjacency_list.erase(entry);
+                removed = true;
+            }
 
+            bool changed = removed;
             for (auto& pair : this->m_adjacency_list) {
+                GRPHX_TOUCH(1, pair.second.size());
+                const size_t before = pair.second.size();
+                const bool live = this->is_live(pair.first, v);
                 pair.second.remove(v);
+                if (pair.second.size() != before) {
+                    this->unindex_edge(pair.first, v);
+                    changed = changed || live;
+                }
             }
+            if (changed)
+                this->modified();
+            if (removed)
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_removed(v); });
         }
 
         /**
@@ -199,14 +1522,32 @@ namespace grphx {
          * @note This function removes the directed edge from vertex `u` to vertex `v`.
          */
         void remove_edge(T u, T v) override {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::remove_edge);
+            auto it = this->find_vertex(u);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
             
             if (it == this->m_adjacency_list.end())
                 return;
 
+            if (this->m_lazy_removal) {
+                if (!this->has_edge(u, it->second, v))
+                    return;
+
+                this->tombstone_edge(u, v);
+                this->modified();
+                this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_removed(u, v); });
+                this->maybe_compact();
+                return;
+            }
+
+            const size_t before = it->second.size();
             it->second.remove(v);
+            if (it->second.size() == before)
+                return;
+
+            this->unindex_edge(u, v);
+            this->modified();
+            this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_removed(u, v); });
         }
 
         /**
@@ -217,14 +1558,14 @@ namespace grphx {
          * @return True if a directed edge exists from vertex `u` to vertex `v`, false otherwise.
          */
         bool contains_edge(T u, T v) const override {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::contains_edge);
+            auto it = this->find_vertex(u);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
 
             if (it == this->m_adjacency_list.end())
                 return false;
             
-            return std::find(it->second.begin(), it->second.end(), v) != it->second.end();
+            return this->has_edge(u, it->second, v);
         }
 
         /**
@@ -234,9 +1575,12 @@ namespace grphx {
          * @return The in-degree of the vertex.
          */
         size_t in_degree(T v) const {
+            GRPHX_INSTRUMENT(graph_operation::in_degree);
             size_t count{ 0 };
             for (const auto& pair : this->m_adjacency_list) {
-                count += std::count(pair.second.begin(), pair.second.end(), v);
+                GRPHX_TOUCH(1, pair.second.size());
+                if (this->is_live(pair.first, v))
+                    count += std::count(pair.second.begin(), pair.second.end(), v);
             }
 
             return count;
@@ -249,11 +1593,11 @@ namespace grphx {
          * @return The out-degree of the vertex.
          */
         size_t out_degree(T v) const {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            GRPHX_INSTRUMENT(graph_operation::out_degree);
+            auto it = this->find_vertex(v);
+            GRPHX_TOUCH(this->scanned(it), 0);
 
-            return it != this->m_adjacency_list.end() ? it->second.size() : 0;
+            return it != this->m_adjacency_list.end() ? this->live_size(v, it->second) : 0;
         }
 
         /**
@@ -262,14 +1606,14 @@ namespace grphx {
          * @param v The vertex for which to find the successors.
          * @return The list of successors of the vertex.
          */
-        std::list<T> successors(T v) const {
+        std::list<T> successors(T v) const override {
+            GRPHX_INSTRUMENT(graph_operation::successors);
             std::list<T> successors;
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            auto it = this->find_vertex(v);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
 
             if (it != this->m_adjacency_list.end()) {
-                successors = it->second;
+                successors = this->live_row(v, it->second);
             }
 
             return successors;
@@ -282,9 +1626,11 @@ namespace grphx {
          * @return The list of predecessors of the vertex.
          */
         std::list<T> predecessors(T v) const {
+            GRPHX_INSTRUMENT(graph_operation::predecessors);
             std::list<T> predecessors;
             for (const auto& pair : this->m_adjacency_list) {
-                if (std::find(pair.second.begin(), pair.second.end(), v) != pair.second.end()) {
+                GRPHX_TOUCH(1, pair.second.size());
+                if (this->is_live(pair.first, v) && std::find(pair.second.begin(), pair.second.end(), v) != pair.second.end()) {
                     predecessors.push_back(pair.first);
                 }
             }
@@ -296,9 +1642,20 @@ namespace grphx {
     template<typename T>
     class undirected_graph : public internal::basic_graph<T> {
     public:
-        undirected_graph() = default;
+        /**
+         * @brief Creates an empty graph that keeps parallel edges, as undirected graphs always have.
+         */
+        undirected_graph() : internal::basic_graph<T>(edge_policy::multigraph, false) {}
         virtual ~undirected_graph() = default;
 
+        /**
+         * @brief Creates an empty graph with an explicit edge policy.
+         * 
+         * @param policy Whether adding an existing edge is ignored or stores a parallel edge.
+         * @param index_edges True to maintain an edge hash index, see `set_edge_index`.
+         */
+        explicit undirected_graph(edge_policy policy, bool index_edges = false) : internal::basic_graph<T>(policy, index_edges) {}
+
         undirected_graph(const undirected_graph&) = delete;
         undirected_graph(undirected_graph&&) = delete;
         undirected_graph& operator=(const undirected_graph&) = delete;
@@ -312,46 +1669,92 @@ namespace grphx {
          * @param v The vertex to add to the graph.
          */
         void add_vertex(T v) override {
+            GRPHX_INSTRUMENT(graph_operation::add_vertex);
             if (!this->contains_vertex(v)) {
+                this->revive(v, v);
                 this->m_adjacency_list.emplace_back(v, std::list<T>());
+                this->index_vertex(std::prev(this->m_adjacency_list.end()));
+                this->modified();
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_added(v); });
             }
         }
 
         /**
          * @brief Adds a new directed edge between two vertices in the graph.
          * 
-         * If either of the vertices does not exist in the graph, it will be added.
+         * If either of the vertices does not exist in the graph, it will be added. With the
+         * `simple` policy adding an existing edge has no effect; the default is `multigraph`.
          * 
          * @param u The source vertex of the edge.
          * @param v The destination vertex of the edge.
          */
         void add_edge(T u, T v) override {
-            auto it_u = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::add_edge);
+            this->revive(u, v);
+            auto it_u = this->find_vertex(u);
 
             if (it_u == this->m_adjacency_list.end()) {
                 // Vertex u not found, add it to the adjacency list
                 this->add_vertex(u);
-                it_u = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                    return pair.first == u;
-                });
+                it_u = this->find_vertex(u);
             }
 
-            auto it_v = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            auto it_v = this->find_vertex(v);
 
             if (it_v == this->m_adjacency_list.end()) {
                 // Vertex v not found, add it to the adjacency list
                 this->add_vertex(v);
-                it_v = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                    return pair.first == v;
-                });
+                it_v = this->find_vertex(v);
             }
 
+            if (this->m_policy == edge_policy::simple && this->has_edge(u, it_u->second, v))
+                return;
+
             it_u->second.push_back(v);
             it_v->second.push_back(u);
+            this->index_edge(u, v);
+            this->index_edge(v, u);
+            this->modified();
+            this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_added(u, v); });
+        }
+
+        /**
+         * @brief Adds many edges at once.
+         * 
+         * Behaves like calling `add_edge` for every edge in order, adding missing vertices, but
+         * finds the vertices through a lookup built once for the batch and starts a single
+         * generation.
+         * 
+         * @param first The first edge, a forward iterator to a pair of values convertible to `T`.
+         * @param last Past the last edge.
+         */
+        template<typename Iterator>
+        void add_edges(Iterator first, Iterator last) {
+            this->insert_edges(first, last, [this](typename internal::basic_graph<T>::batch_lookup& lookup, const T& u, const T& v) {
+                this->revive(u, v);
+                const auto entry_u = lookup.insert(u);
+                const auto entry_v = lookup.insert(v);
+                auto it_u = entry_u.first;
+                auto it_v = entry_v.first;
+                if (this->m_policy == edge_policy::simple && this->has_edge(u, it_u->second, v))
+                    return entry_u.second || entry_v.second;
+
+                it_u->second.push_back(v);
+                it_v->second.push_back(u);
+                this->index_edge(u, v);
+                this->index_edge(v, u);
+                this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_added(u, v); });
+                return true;
+            });
+        }
+
+        /**
+         * @brief Adds many edges at once.
+         * 
+         * @param edges The edges as pairs of vertices.
+         */
+        void add_edges(const std::vector<std::pair<T, T>>& edges) {
+            this->add_edges(edges.begin(), edges.end());
         }
 
         /**
@@ -362,15 +1765,43 @@ namespace grphx {
          * @param v The vertex to remove from the graph.
          */
         void remove_vertex(T v) override {
-            auto it = std::remove_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(),
-                                     [&v](const std::pair<T, std::list<T>>& pair) {
-                                         return pair.first == v;
-                                     });
-            this->m_adjacency_list.erase(it, this->m_adjacency_list.end());
+            GRPHX_INSTRUMENT(graph_operation::remove_vertex);
+            bool removed = false;
+            auto entry = this->find_vertex(v);
+            if (this->m_lazy_removal && entry != this->m_adjacency_list.end()) {
+                this->tombstone_vertex(entry);
+                this->modified();
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_removed(v); });
+                this->maybe_compact();
+                return;
+            }
+
+            if (entry != this->m_adjacency_list.end()) {
+                if (this->m_edge_index_enabled) {
+                    for (const auto& neighbor : entry->second) {
+                        this->unindex_edge(v, neighbor);
+                    }
+                }
+                this->unindex_vertex(v);
+                this->m_adjacency_list.erase(entry);
+                removed = true;
+            }
 
+            bool changed = removed;
             for (auto& pair : this->m_adjacency_list) {
+                GRPHX_TOUCH(1, pair.second.size());
+                const size_t before = pair.second.size();
+                const bool live = this->is_live(pair.first, v);
                 pair.second.remove(v);
+                if (pair.second.size() != before) {
+                    this->unindex_edge(pair.first, v);
+                    changed = changed || live;
+                }
             }
+            if (changed)
+                this->modified();
+            if (removed)
+                this->notify([&v](graph_observer<T>& observer) { observer.vertex_removed(v); });
         }
 
         /**
@@ -382,22 +1813,39 @@ namespace grphx {
          * @param v The destination vertex of the edge.
          */
         void remove_edge(T u, T v) override {
-            auto it_u = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::remove_edge);
+            auto it_u = this->find_vertex(u);
 
             if (it_u == this->m_adjacency_list.end())
                 return;
 
-            auto it_v = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            auto it_v = this->find_vertex(v);
             
             if (it_v == this->m_adjacency_list.end())
                 return;
 
+            if (this->m_lazy_removal) {
+                if (!this->has_edge(u, it_u->second, v))
+                    return;
+
+                this->tombstone_edge(u, v);
+                this->tombstone_edge(v, u);
+                this->modified();
+                this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_removed(u, v); });
+                this->maybe_compact();
+                return;
+            }
+
+            const size_t before = it_u->second.size();
             it_u->second.remove(v);
+            if (it_u->second.size() == before)
+                return;
+
             it_v->second.remove(u);
+            this->unindex_edge(u, v);
+            this->unindex_edge(v, u);
+            this->modified();
+            this->notify([&u, &v](graph_observer<T>& observer) { observer.edge_removed(u, v); });
         }
 
         /**
@@ -408,14 +1856,14 @@ namespace grphx {
          * @return True if an edge exists between vertices `u` and `v`, false otherwise.
          */
         bool contains_edge(T u, T v) const override {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&u](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == u;
-            });
+            GRPHX_INSTRUMENT(graph_operation::contains_edge);
+            auto it = this->find_vertex(u);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
 
             if (it == this->m_adjacency_list.end())
                 return false;
             
-            return std::find(it->second.begin(), it->second.end(), v) != it->second.end();
+            return this->has_edge(u, it->second, v);
         }
 
         /**
@@ -425,11 +1873,11 @@ namespace grphx {
          * @return The degree of the vertex.
          */
         size_t degree(T v) const {
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            GRPHX_INSTRUMENT(graph_operation::degree);
+            auto it = this->find_vertex(v);
+            GRPHX_TOUCH(this->scanned(it), 0);
 
-            return it != this->m_adjacency_list.end() ? it->second.size() : 0;
+            return it != this->m_adjacency_list.end() ? this->live_size(v, it->second) : 0;
         }
 
         /**
@@ -439,17 +1887,32 @@ namespace grphx {
          * @return The list of neighbors of the vertex.
          */
         std::list<T> neighbors(T v) const {
+            GRPHX_INSTRUMENT(graph_operation::neighbors);
             std::list<T> neighbors;
-            auto it = std::find_if(this->m_adjacency_list.begin(), this->m_adjacency_list.end(), [&v](const std::pair<T, std::list<T>>& pair) {
-                return pair.first == v;
-            });
+            auto it = this->find_vertex(v);
+            GRPHX_TOUCH(this->scanned(it), it != this->m_adjacency_list.end() ? it->second.size() : 0);
 
             if (it != this->m_adjacency_list.end()) {
-                neighbors = it->second;
+                neighbors = this->live_row(v, it->second);
             }
 
             return neighbors;
         }
+
+        /**
+         * @brief Returns the list of neighbors of a vertex, the successors of a vertex in an undirected graph.
+         * 
+         * @param v The vertex for which to find the successors.
+         * @return The list of neighbors of the vertex.
+         */
+        std::list<T> successors(T v) const override {
+            return this->neighbors(v);
+        }
+
+    protected:
+        bool is_symmetric() const override {
+            return true;
+        }
     }; 
 
 } // end of namespace grphx
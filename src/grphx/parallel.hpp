@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Returns the number of workers to use for `work` items.
+         *
+         * @param threads The requested number of threads; 0 selects the hardware concurrency.
+         * @param work The number of independent work items.
+         */
+        inline size_t worker_count(size_t threads, size_t work) {
+            if (threads == 0) {
+                threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            }
+
+            return std::max<size_t>(std::min(threads, work), 1);
+        }
+
+        /**
+         * @brief Splits [0, count) into contiguous blocks and runs `function(worker, begin, end)` on each.
+         *
+         * Block `w` is handed to worker `w`; worker 0 runs on the calling thread. The split only
+         * depends on `count` and the worker count, so per-worker results can be merged
+         * deterministically. The first exception thrown by a worker is rethrown after all workers
+         * have joined.
+         *
+         * @param count The number of items.
+         * @param threads The requested number of threads; 0 selects the hardware concurrency.
+         * @param function The block body.
+         * @return The number of workers used.
+         */
+        template<typename Function>
+        size_t parallel_for(size_t count, size_t threads, Function&& function) {
+            const size_t workers = worker_count(threads, count);
+            std::vector<std::exception_ptr> errors(workers);
+            auto run = [&](size_t worker) {
+                try {
+                    function(worker, count * worker / workers, count * (worker + 1) / workers);
+                }
+                catch (...) {
+                    errors[worker] = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> pool;
+            pool.reserve(workers - 1);
+            for (size_t worker = 1; worker < workers; ++worker) {
+                pool.emplace_back(run, worker);
+            }
+            run(0);
+            for (auto& thread : pool) {
+                thread.join();
+            }
+
+            for (const auto& error : errors) {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+
+            return workers;
+        }
+
+        /**
+         * @brief Sorts a vector by sorting contiguous blocks in parallel and merging them pairwise.
+         *
+         * @param values The values to sort.
+         * @param less The strict weak ordering.
+         * @param threads The number of threads; 0 selects the hardware concurrency.
+         */
+        template<typename Value, typename Compare>
+        void parallel_sort(std::vector<Value>& values, Compare less, size_t threads) {
+            const size_t count = values.size();
+            const size_t blocks = worker_count(threads, count / 4096 + 1);
+            auto bound = [count, blocks](size_t block) { return count * std::min(block, blocks) / blocks; };
+
+            parallel_for(blocks, blocks, [&](size_t, size_t begin, size_t end) {
+                for (size_t block = begin; block < end; ++block) {
+                    std::sort(values.begin() + bound(block), values.begin() + bound(block + 1), less);
+                }
+            });
+
+            for (size_t width = 1; width < blocks; width *= 2) {
+                const size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+                parallel_for(pairs, blocks, [&](size_t, size_t begin, size_t end) {
+                    for (size_t pair = begin; pair < end; ++pair) {
+                        const size_t first = 2 * width * pair;
+                        std::inplace_merge(values.begin() + bound(first), values.begin() + bound(first + width),
+                                           values.begin() + bound(first + 2 * width), less);
+                    }
+                });
+            }
+        }
+
+        /**
+         * @brief SplitMix64 finalizer, a cheap bijective mixer used as a counter-based random number generator.
+         */
+        constexpr std::uint64_t mix64(std::uint64_t x) {
+            x += 0x9e3779b97f4a7c15ULL;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+    } // end of namespace internal
+
+} // end of namespace grphx
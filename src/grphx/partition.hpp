@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Strategies used to split a graph into partitions.
+     */
+    enum class partition_strategy {
+        hash,       ///< Every vertex is assigned to a partition by hashing its dense id.
+        edge_cut,   ///< Linear deterministic greedy vertex placement that minimizes cut edges.
+        vertex_cut  ///< Greedy edge placement; vertices are replicated where their edges land.
+    };
+
+    /**
+     * @brief One partition of a graph, described with the dense ids of the source `csr_graph`.
+     */
+    struct graph_partition {
+        std::vector<size_t> masters;    ///< Vertices whose state is owned by this partition.
+        std::vector<size_t> ghosts;     ///< Vertices referenced by local edges but owned by another partition.
+        std::vector<size_t> sources;    ///< Vertices with local out-edges, one row each.
+        std::vector<size_t> offsets;    ///< Row offsets into `targets`, parallel to `sources`.
+        std::vector<size_t> targets;    ///< Targets of the local edges.
+    };
+
+    /**
+     * @brief A graph split into a number of partitions with ghost-vertex tables.
+     *
+     * With `edge_cut` and `hash` every edge is stored in the partition that owns its source.
+     * With `vertex_cut` the edges are distributed and a vertex has a row in every partition that
+     * holds one of its out-edges; its state is still owned by exactly one master partition.
+     */
+    template<typename T>
+    class partitioned_graph {
+    public:
+        /**
+         * @brief Splits a graph into `count` partitions.
+         *
+         * @param graph The graph to split.
+         * @param count The number of partitions, at least 1.
+         * @param strategy The partitioning strategy.
+         */
+        partitioned_graph(const csr_graph<T>& graph, size_t count, partition_strategy strategy)
+            : m_vertices(graph.vertices()), m_owner(graph.size()), m_parts(std::max<size_t>(count, 1)) {
+            const size_t parts = this->m_parts.size();
+            std::vector<std::vector<std::pair<size_t, size_t>>> edges(parts);
+
+            if (strategy == partition_strategy::vertex_cut) {
+                this->place_edges(graph, edges);
+            }
+            else {
+                if (strategy == partition_strategy::hash) {
+                    for (size_t v = 0; v < graph.size(); ++v) {
+                        this->m_owner[v] = static_cast<size_t>(mix(v) % parts);
+                    }
+                }
+                else {
+                    this->place_vertices(graph);
+                }
+
+                for (size_t u = 0; u < graph.size(); ++u) {
+                    for (const size_t* it = graph.row_begin(u); it != graph.row_end(u); ++it) {
+                        edges[this->m_owner[u]].emplace_back(u, *it);
+                    }
+                }
+            }
+
+            this->assemble(edges);
+        }
+
+        /**
+         * @brief Returns the number of partitions.
+         */
+        size_t partition_count() const {
+            return this->m_parts.size();
+        }
+
+        /**
+         * @brief Returns a partition.
+         */
+        const graph_partition& part(size_t index) const {
+            return this->m_parts[index];
+        }
+
+        /**
+         * @brief Returns the partition owning the state of a dense vertex id.
+         */
+        size_t owner(size_t id) const {
+            return this->m_owner[id];
+        }
+
+        /**
+         * @brief Returns the partitions holding out-edges of a dense vertex id.
+         */
+        std::vector<size_t> holders(size_t id) const {
+            return std::vector<size_t>(this->m_holders.begin() + this->m_holder_offsets[id],
+                                       this->m_holders.begin() + this->m_holder_offsets[id + 1]);
+        }
+
+        /**
+         * @brief Returns the number of vertices of the partitioned graph.
+         */
+        size_t size() const {
+            return this->m_vertices.size();
+        }
+
+        /**
+         * @brief Returns the vertex with the given dense id.
+         */
+        const T& vertex_at(size_t id) const {
+            return this->m_vertices[id];
+        }
+
+        /**
+         * @brief Returns the number of edges whose target is owned by another partition than the one storing it.
+         */
+        size_t cut_edges() const {
+            size_t count{ 0 };
+            for (size_t p = 0; p < this->m_parts.size(); ++p) {
+                for (size_t target : this->m_parts[p].targets) {
+                    count += this->m_owner[target] != p;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Returns the average number of partitions a vertex appears in, as master or ghost.
+         */
+        double replication_factor() const {
+            if (this->m_vertices.empty())
+                return 0.0;
+
+            size_t copies{ 0 };
+            for (const auto& part : this->m_parts) {
+                copies += part.masters.size() + part.ghosts.size();
+            }
+
+            return static_cast<double>(copies) / static_cast<double>(this->m_vertices.size());
+        }
+
+    private:
+        static std::uint64_t mix(std::uint64_t x) {
+            x += 0x9e3779b97f4a7c15ULL;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        void place_vertices(const csr_graph<T>& graph) {
+            // Linear deterministic greedy: put every vertex where most of its already placed
+            // neighbors are, penalized by the fill ratio of the partition
+            const size_t parts = this->m_parts.size();
+            const size_t capacity = (graph.size() + parts - 1) / parts;
+            const size_t unassigned = std::numeric_limits<size_t>::max();
+            std::vector<size_t> load(parts, 0);
+            std::vector<double> score(parts);
+            std::fill(this->m_owner.begin(), this->m_owner.end(), unassigned);
+
+            for (size_t v = 0; v < graph.size(); ++v) {
+                std::fill(score.begin(), score.end(), 0.0);
+                for (const size_t* it = graph.row_begin(v); it != graph.row_end(v); ++it) {
+                    if (this->m_owner[*it] != unassigned) {
+                        score[this->m_owner[*it]] += 1.0;
+                    }
+                }
+
+                size_t best{ 0 };
+                double best_score{ -1.0 };
+                for (size_t p = 0; p < parts; ++p) {
+                    if (load[p] >= capacity)
+                        continue;
+
+                    const double weighted = score[p] * (1.0 - static_cast<double>(load[p]) / static_cast<double>(capacity));
+                    if (weighted > best_score || (weighted == best_score && load[p] < load[best])) {
+                        best = p;
+                        best_score = weighted;
+                    }
+                }
+
+                this->m_owner[v] = best;
+                ++load[best];
+            }
+        }
+
+        void place_edges(const csr_graph<T>& graph, std::vector<std::vector<std::pair<size_t, size_t>>>& edges) {
+            // Greedy vertex-cut: place every edge on a partition that already holds its endpoints,
+            // preferring the least loaded one
+            const size_t parts = this->m_parts.size();
+            std::vector<std::vector<bool>> replicas(graph.size(), std::vector<bool>(parts, false));
+            std::vector<size_t> load(parts, 0);
+
+            auto least_loaded = [&load, parts](auto&& allowed) {
+                size_t best = parts;
+                for (size_t p = 0; p < parts; ++p) {
+                    if (allowed(p) && (best == parts || load[p] < load[best])) {
+                        best = p;
+                    }
+                }
+                return best;
+            };
+
+            for (size_t u = 0; u < graph.size(); ++u) {
+                for (const size_t* it = graph.row_begin(u); it != graph.row_end(u); ++it) {
+                    const auto& ru = replicas[u];
+                    const auto& rv = replicas[*it];
+                    size_t target = least_loaded([&](size_t p) { return ru[p] && rv[p]; });
+                    if (target == parts)
+                        target = least_loaded([&](size_t p) { return ru[p] || rv[p]; });
+                    if (target == parts)
+                        target = least_loaded([](size_t) { return true; });
+
+                    replicas[u][target] = true;
+                    replicas[*it][target] = true;
+                    edges[target].emplace_back(u, *it);
+                    ++load[target];
+                }
+            }
+
+            for (size_t v = 0; v < graph.size(); ++v) {
+                auto first = std::find(replicas[v].begin(), replicas[v].end(), true);
+                this->m_owner[v] = first != replicas[v].end() ? static_cast<size_t>(first - replicas[v].begin())
+                                                              : static_cast<size_t>(mix(v) % parts);
+            }
+        }
+
+        void assemble(std::vector<std::vector<std::pair<size_t, size_t>>>& edges) {
+            const size_t parts = this->m_parts.size();
+            std::vector<std::vector<size_t>> holders(this->m_vertices.size());
+
+            for (size_t v = 0; v < this->m_vertices.size(); ++v) {
+                this->m_parts[this->m_owner[v]].masters.push_back(v);
+            }
+
+            for (size_t p = 0; p < parts; ++p) {
+                auto& part = this->m_parts[p];
+                std::sort(edges[p].begin(), edges[p].end());
+                std::vector<size_t> ghosts;
+
+                part.offsets.push_back(0);
+                for (size_t i = 0; i < edges[p].size(); ++i) {
+                    const size_t u = edges[p][i].first;
+                    const size_t v = edges[p][i].second;
+                    if (part.sources.empty() || part.sources.back() != u) {
+                        if (!part.sources.empty())
+                            part.offsets.push_back(part.targets.size());
+                        part.sources.push_back(u);
+                        holders[u].push_back(p);
+                    }
+                    part.targets.push_back(v);
+
+                    if (this->m_owner[u] != p)
+                        ghosts.push_back(u);
+                    if (this->m_owner[v] != p)
+                        ghosts.push_back(v);
+                }
+                if (!part.sources.empty())
+                    part.offsets.push_back(part.targets.size());
+
+                std::sort(ghosts.begin(), ghosts.end());
+                ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+                part.ghosts = std::move(ghosts);
+            }
+
+            this->m_holder_offsets.assign(1, 0);
+            for (const auto& list : holders) {
+                this->m_holders.insert(this->m_holders.end(), list.begin(), list.end());
+                this->m_holder_offsets.push_back(this->m_holders.size());
+            }
+        }
+
+        std::vector<T> m_vertices;
+        std::vector<size_t> m_owner;
+        std::vector<graph_partition> m_parts;
+        std::vector<size_t> m_holder_offsets;
+        std::vector<size_t> m_holders;
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Type-erased property column that a dynamic graph keeps in step with its vertex ids.
+         */
+        class property_column {
+        public:
+            virtual ~property_column() = default;
+
+            /**
+             * @brief Grows the column to `size` entries; new entries get the initial value.
+             */
+            virtual void resize(size_t size) = 0;
+
+            /**
+             * @brief Resets one entry to the initial value.
+             */
+            virtual void reset(size_t id) = 0;
+
+            /**
+             * @brief Renumbers the column: entry `i` becomes the old entry `ids[i]`.
+             */
+            virtual void gather(const std::vector<size_t>& ids) = 0;
+        };
+
+        /**
+         * @brief A contiguous column of values indexed by dense id.
+         */
+        template<typename P>
+        class dense_column {
+        public:
+            using value_type = P;
+            using reference = typename std::vector<P>::reference;
+            using const_reference = typename std::vector<P>::const_reference;
+
+            dense_column() = default;
+
+            dense_column(size_t size, const P& initial) : m_values(size, initial), m_initial(initial) {}
+
+            /**
+             * @brief Returns the value of an id.
+             */
+            reference operator[](size_t id) {
+                return this->m_values[id];
+            }
+
+            /**
+             * @brief Returns the value of an id.
+             */
+            const_reference operator[](size_t id) const {
+                return this->m_values[id];
+            }
+
+            /**
+             * @brief Returns the value of an id, so that the column can be passed to algorithms as a callable.
+             */
+            const_reference operator()(size_t id) const {
+                return this->m_values[id];
+            }
+
+            /**
+             * @brief Returns the number of entries.
+             */
+            size_t size() const {
+                return this->m_values.size();
+            }
+
+            /**
+             * @brief Returns the value that new and reset entries get.
+             */
+            const P& initial() const {
+                return this->m_initial;
+            }
+
+            /**
+             * @brief Sets every entry to `value`.
+             */
+            void fill(const P& value) {
+                this->m_values.assign(this->m_values.size(), value);
+            }
+
+            /**
+             * @brief Returns the underlying storage.
+             */
+            const std::vector<P>& values() const {
+                return this->m_values;
+            }
+
+        protected:
+            std::vector<P> m_values;
+            P m_initial{};
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief A typed vertex attribute stored as a contiguous column indexed by dense vertex id.
+     *
+     * Every property is its own column, so a traversal that reads one attribute only touches
+     * that attribute's memory and never hashes the vertex key. A property built from a
+     * `csr_graph` matches its ids for the lifetime of the snapshot; a property created with
+     * `delta_graph::add_vertex_property` is kept consistent by the graph across insertions,
+     * removals and compactions.
+     *
+     * @tparam P The attribute type.
+     */
+    template<typename P>
+    class vertex_property : public internal::dense_column<P>, public internal::property_column {
+    public:
+        vertex_property() = default;
+
+        /**
+         * @brief Creates a column with one entry per vertex of a CSR graph.
+         *
+         * @param graph The graph whose dense vertex ids index the column.
+         * @param initial The value of every entry.
+         */
+        template<typename T>
+        explicit vertex_property(const csr_graph<T>& graph, const P& initial = P()) : internal::dense_column<P>(graph.size(), initial) {}
+
+        /**
+         * @brief Creates a column of `size` entries.
+         */
+        vertex_property(size_t size, const P& initial) : internal::dense_column<P>(size, initial) {}
+
+        /**
+         * @brief Returns the value of a vertex by key, or throws `std::out_of_range` if the vertex is not in the graph.
+         */
+        template<typename Graph, typename T>
+        typename internal::dense_column<P>::reference at(const Graph& graph, const T& v) {
+            return this->m_values.at(graph.id_of(v));
+        }
+
+        /**
+         * @brief Returns the value of a vertex by key, or throws `std::out_of_range` if the vertex is not in the graph.
+         */
+        template<typename Graph, typename T>
+        typename internal::dense_column<P>::const_reference at(const Graph& graph, const T& v) const {
+            return this->m_values.at(graph.id_of(v));
+        }
+
+        void resize(size_t size) override {
+            this->m_values.resize(size, this->m_initial);
+        }
+
+        void reset(size_t id) override {
+            this->m_values[id] = this->m_initial;
+        }
+
+        void gather(const std::vector<size_t>& ids) override {
+            std::vector<P> values;
+            values.reserve(ids.size());
+            for (size_t id : ids) {
+                values.push_back(this->m_values[id]);
+            }
+            this->m_values.swap(values);
+        }
+    };
+
+    /**
+     * @brief A typed edge attribute stored as a contiguous column indexed by CSR edge id.
+     *
+     * The edge id is the position of the edge in `csr_graph::targets()`, which is what the
+     * weight callable of `astar` receives, so an `edge_property<double>` can be passed to it as
+     * the weights. Both directions of an undirected edge have their own entry.
+     *
+     * @tparam P The attribute type.
+     */
+    template<typename P>
+    class edge_property : public internal::dense_column<P> {
+    public:
+        edge_property() = default;
+
+        /**
+         * @brief Creates a column with one entry per stored edge of a CSR graph.
+         *
+         * @param graph The graph whose edge ids index the column.
+         * @param initial The value of every entry.
+         */
+        template<typename T>
+        explicit edge_property(const csr_graph<T>& graph, const P& initial = P()) : internal::dense_column<P>(graph.edge_count(), initial) {}
+
+        /**
+         * @brief Returns the value of the edge from `u` to `v`, or throws `std::out_of_range` if there is no such edge.
+         */
+        template<typename T>
+        typename internal::dense_column<P>::reference at(const csr_graph<T>& graph, const T& u, const T& v) {
+            return this->m_values.at(edge_of(graph, u, v));
+        }
+
+        /**
+         * @brief Returns the value of the edge from `u` to `v`, or throws `std::out_of_range` if there is no such edge.
+         */
+        template<typename T>
+        typename internal::dense_column<P>::const_reference at(const csr_graph<T>& graph, const T& u, const T& v) const {
+            return this->m_values.at(edge_of(graph, u, v));
+        }
+
+    private:
+        template<typename T>
+        static size_t edge_of(const csr_graph<T>& graph, const T& u, const T& v) {
+            const size_t iu = graph.id_of(u);
+            const size_t iv = graph.id_of(v);
+            return iu != csr_graph<T>::npos && iv != csr_graph<T>::npos ? graph.find_edge(iu, iv) : csr_graph<T>::npos;
+        }
+    };
+
+} // end of namespace grphx
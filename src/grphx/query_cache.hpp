@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "grphx.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief The kind of query a cached result answers.
+     */
+    enum class query_kind {
+        bfs,      ///< `bfs(start)`
+        dfs,      ///< `dfs(start)`
+        reachable ///< The set of vertices reachable from `start`.
+    };
+
+    /**
+     * @brief Counters of a `query_cache`.
+     */
+    struct query_cache_stats {
+        size_t hits{ 0 };          ///< Queries answered from the cache.
+        size_t misses{ 0 };        ///< Queries that had to be computed.
+        size_t evictions{ 0 };     ///< Results dropped to stay within the capacity.
+        size_t invalidations{ 0 }; ///< Times the whole cache was dropped because the graph changed.
+
+        /**
+         * @brief Returns the fraction of queries answered from the cache.
+         */
+        double hit_ratio() const {
+            const size_t queries = this->hits + this->misses;
+            return queries != 0 ? static_cast<double>(this->hits) / static_cast<double>(queries) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Memoizes traversal and reachability queries on a graph between updates.
+     *
+     * Results are keyed on the query kind and the start vertex and kept in least-recently-used
+     * order up to `capacity` entries. Every graph mutation starts a new generation (see
+     * `basic_graph::generation`); the first query after that drops all cached results, so answers
+     * are never stale. The cache holds a reference to the graph, which must outlive it.
+     *
+     * @tparam T The vertex type; it must be hashable with `std::hash`.
+     */
+    template<typename T>
+    class query_cache {
+    public:
+        /**
+         * @brief Creates an empty cache for a graph.
+         *
+         * @param graph The graph whose queries are cached.
+         * @param capacity The maximum number of cached results; 0 disables caching.
+         */
+        explicit query_cache(const internal::basic_graph<T>& graph, size_t capacity = 1024)
+            : m_graph(graph), m_capacity(capacity), m_generation(graph.generation()) {}
+
+        query_cache(const query_cache&) = delete;
+        query_cache& operator=(const query_cache&) = delete;
+
+        /**
+         * @brief Cached `bfs(start)`.
+         *
+         * @return The vertices visited during BFS traversal; the reference is valid until the next call to the cache.
+         */
+        const std::vector<T>& bfs(const T& start) {
+            return this->lookup(query_kind::bfs, start).vertices;
+        }
+
+        /**
+         * @brief Cached `dfs(start)`.
+         *
+         * @return The vertices visited during DFS traversal; the reference is valid until the next call to the cache.
+         */
+        const std::vector<T>& dfs(const T& start) {
+            return this->lookup(query_kind::dfs, start).vertices;
+        }
+
+        /**
+         * @brief Checks if there is a path from vertex `u` to vertex `v`.
+         *
+         * The set of vertices reachable from `u` is cached, so later checks from `u` take
+         * constant time until the graph changes.
+         */
+        bool is_reachable(const T& u, const T& v) {
+            const entry& reach = this->lookup(query_kind::reachable, u);
+            return reach.members.find(v) != reach.members.end();
+        }
+
+        /**
+         * @brief Returns the number of cached results.
+         */
+        size_t size() const {
+            return this->m_entries.size();
+        }
+
+        /**
+         * @brief Returns the maximum number of cached results.
+         */
+        size_t capacity() const {
+            return this->m_capacity;
+        }
+
+        /**
+         * @brief Changes the maximum number of cached results, evicting the least recently used ones.
+         */
+        void set_capacity(size_t capacity) {
+            this->m_capacity = capacity;
+            this->trim(capacity);
+        }
+
+        /**
+         * @brief Drops all cached results; the statistics are kept.
+         */
+        void clear() {
+            this->m_entries.clear();
+            this->m_lookup.clear();
+        }
+
+        /**
+         * @brief Returns the hit, miss and eviction counters.
+         */
+        const query_cache_stats& stats() const {
+            return this->m_stats;
+        }
+
+        /**
+         * @brief Resets the hit, miss and eviction counters.
+         */
+        void reset_stats() {
+            this->m_stats = query_cache_stats();
+        }
+
+    private:
+        using key_type = std::pair<query_kind, T>;
+
+        struct entry {
+            key_type key;
+            std::vector<T> vertices;
+            std::unordered_set<T> members; ///< Filled for `query_kind::reachable` only.
+        };
+
+        struct key_hash {
+            size_t operator()(const key_type& key) const {
+                return std::hash<T>()(key.second) * 3 + static_cast<size_t>(key.first);
+            }
+        };
+
+        const entry& lookup(query_kind kind, const T& start) {
+            if (this->m_generation != this->m_graph.generation()) {
+                if (!this->m_entries.empty())
+                    ++this->m_stats.invalidations;
+                this->clear();
+                this->m_generation = this->m_graph.generation();
+            }
+
+            const key_type key{ kind, start };
+            auto it = this->m_lookup.find(key);
+            if (it != this->m_lookup.end()) {
+                ++this->m_stats.hits;
+                this->m_entries.splice(this->m_entries.begin(), this->m_entries, it->second);
+                return *it->second;
+            }
+
+            ++this->m_stats.misses;
+            entry result{ key, kind == query_kind::dfs ? this->m_graph.dfs(start) : this->m_graph.bfs(start), {} };
+            if (kind == query_kind::reachable) {
+                result.members.insert(result.vertices.begin(), result.vertices.end());
+                std::vector<T>().swap(result.vertices);
+            }
+
+            // Without capacity the result only needs a home until the caller has read it
+            if (this->m_capacity == 0) {
+                this->m_uncached = std::move(result);
+                return this->m_uncached;
+            }
+
+            this->trim(this->m_capacity - 1);
+            this->m_entries.push_front(std::move(result));
+            this->m_lookup.emplace(key, this->m_entries.begin());
+            return this->m_entries.front();
+        }
+
+        void trim(size_t limit) {
+            while (this->m_entries.size() > limit) {
+                this->m_lookup.erase(this->m_entries.back().key);
+                this->m_entries.pop_back();
+                ++this->m_stats.evictions;
+            }
+        }
+
+        const internal::basic_graph<T>& m_graph;
+        size_t m_capacity;
+        std::uint64_t m_generation;
+        std::list<entry> m_entries;
+        std::unordered_map<key_type, typename std::list<entry>::iterator, key_hash> m_lookup;
+        entry m_uncached;
+        query_cache_stats m_stats;
+    };
+
+} // end of namespace grphx
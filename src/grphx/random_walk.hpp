@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief SplitMix64 generator: one addition and one mix per number, 8 bytes of state.
+         */
+        class splitmix64 {
+        public:
+            explicit splitmix64(std::uint64_t seed) : m_state(seed) {}
+
+            std::uint64_t next() {
+                const std::uint64_t value = mix64(this->m_state);
+                this->m_state += 0x9e3779b97f4a7c15ULL;
+                return value;
+            }
+
+            /**
+             * @brief Returns a uniform double in [0, 1).
+             */
+            double uniform() {
+                return static_cast<double>(this->next() >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+            /**
+             * @brief Returns a uniform integer in [0, bound).
+             */
+            size_t below(size_t bound) {
+                return static_cast<size_t>(this->next() % bound);
+            }
+
+        private:
+            std::uint64_t m_state;
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief Batched random-walk engine over a CSR graph, for uniform and node2vec walks.
+     *
+     * Weighted graphs get one alias table per row, built once, so every step samples the next
+     * edge in O(1). The node2vec bias of the return parameter `p` and the in-out parameter `q`
+     * is applied by rejection against that first-order distribution, which keeps the memory at
+     * O(E) instead of one table per edge.
+     *
+     * Every walk draws from its own generator seeded by `seed` and the walk's index, so the
+     * result is the same for any number of threads.
+     */
+    template<typename T>
+    class random_walker {
+    public:
+        using vertex_id = typename csr_graph<T>::vertex_id;
+
+        static constexpr vertex_id npos = csr_graph<T>::npos;
+
+        /**
+         * @brief Prepares the sampling tables of a graph.
+         *
+         * @param graph The graph to walk on; it must outlive the walker.
+         */
+        explicit random_walker(const csr_graph<T>& graph) : m_graph(graph) {
+            if (!graph.is_weighted())
+                return;
+
+            // Vose's alias method, one table per row laid out like the edges
+            this->m_probability.resize(graph.edge_count());
+            this->m_alias.resize(graph.edge_count());
+            std::vector<double> scaled;
+            std::vector<size_t> small;
+            std::vector<size_t> large;
+            for (vertex_id v = 0; v < graph.size(); ++v) {
+                const size_t begin = graph.offsets()[v];
+                const size_t degree = graph.row_size(v);
+                double total{ 0.0 };
+                for (size_t i = 0; i < degree; ++i) {
+                    total += graph.weight(begin + i);
+                }
+
+                scaled.resize(degree);
+                small.clear();
+                large.clear();
+                for (size_t i = 0; i < degree; ++i) {
+                    scaled[i] = total > 0.0 ? graph.weight(begin + i) * static_cast<double>(degree) / total : 1.0;
+                    (scaled[i] < 1.0 ? small : large).push_back(i);
+                }
+
+                while (!small.empty() && !large.empty()) {
+                    const size_t less = small.back();
+                    const size_t more = large.back();
+                    small.pop_back();
+                    this->m_probability[begin + less] = scaled[less];
+                    this->m_alias[begin + less] = more;
+                    scaled[more] -= 1.0 - scaled[less];
+                    if (scaled[more] < 1.0) {
+                        large.pop_back();
+                        small.push_back(more);
+                    }
+                }
+                for (size_t i : large) {
+                    this->m_probability[begin + i] = 1.0;
+                }
+                for (size_t i : small) {
+                    this->m_probability[begin + i] = 1.0;
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of walks `random_walks` produces.
+         */
+        static size_t walk_count(size_t starts, size_t walks_per_vertex) {
+            return starts * walks_per_vertex;
+        }
+
+        /**
+         * @brief Runs random walks and writes them into a caller provided buffer.
+         *
+         * Walk `i * walks_per_vertex + r` is the `r`-th walk from `starts[i]` and occupies
+         * `buffer[(i * walks_per_vertex + r) * length, ... + length)` as dense ids. Walks that hit
+         * a vertex without out-edges, and all walks from a start that is not in the graph, are
+         * padded with `npos`.
+         *
+         * @param starts The start vertices.
+         * @param length The number of vertices per walk, including the start.
+         * @param walks_per_vertex The number of walks from every start vertex.
+         * @param p The node2vec return parameter; 1 for no bias.
+         * @param q The node2vec in-out parameter; 1 for no bias.
+         * @param buffer Receives `walk_count(starts.size(), walks_per_vertex) * length` ids.
+         * @param threads The number of threads; 0 selects the hardware concurrency.
+         * @param seed The seed of the walks.
+         * @throws std::invalid_argument if `p` or `q` is not a positive finite number.
+         */
+        void random_walks_into(const std::vector<T>& starts, size_t length, size_t walks_per_vertex, double p, double q,
+                               vertex_id* buffer, size_t threads = 0, std::uint64_t seed = 0) const {
+            // The rejection sampling of a step accepts with probability bias / max(1 / p, 1, 1 / q)
+            if (!(p > 0.0 && std::isfinite(p) && q > 0.0 && std::isfinite(q)))
+                throw std::invalid_argument("random walk: p and q must be positive and finite");
+
+            std::vector<vertex_id> sources(starts.size());
+            for (size_t i = 0; i < starts.size(); ++i) {
+                sources[i] = this->m_graph.id_of(starts[i]);
+            }
+
+            const size_t walks = walk_count(sources.size(), walks_per_vertex);
+            internal::parallel_for(walks, threads, [&](size_t, size_t begin, size_t end) {
+                for (size_t w = begin; w < end; ++w) {
+                    this->walk(sources[w / walks_per_vertex], length, p, q, internal::mix64(seed ^ internal::mix64(w)), buffer + w * length);
+                }
+            });
+        }
+
+        /**
+         * @brief Runs random walks and returns them in a flat buffer.
+         *
+         * @see random_walks_into for the layout and the parameters.
+         */
+        std::vector<vertex_id> random_walks(const std::vector<T>& starts, size_t length, size_t walks_per_vertex = 1,
+                                            double p = 1.0, double q = 1.0, size_t threads = 0, std::uint64_t seed = 0) const {
+            std::vector<vertex_id> buffer(walk_count(starts.size(), walks_per_vertex) * length);
+            this->random_walks_into(starts, length, walks_per_vertex, p, q, buffer.data(), threads, seed);
+            return buffer;
+        }
+
+    private:
+        void walk(vertex_id start, size_t length, double p, double q, std::uint64_t seed, vertex_id* out) const {
+            std::fill(out, out + length, npos);
+            if (start == npos || length == 0)
+                return;
+
+            internal::splitmix64 rng(seed);
+            const bool biased = p != 1.0 || q != 1.0;
+            const double max_bias = std::max({ 1.0 / p, 1.0, 1.0 / q });
+            const auto& targets = this->m_graph.targets();
+
+            vertex_id previous = npos;
+            vertex_id current = start;
+            out[0] = start;
+            for (size_t step = 1; step < length; ++step) {
+                const size_t degree = this->m_graph.row_size(current);
+                if (degree == 0)
+                    return;
+
+                const size_t begin = this->m_graph.offsets()[current];
+                vertex_id next;
+                for (;;) {
+                    next = targets[begin + this->sample(begin, degree, rng)];
+                    if (!biased || previous == npos)
+                        break;
+
+                    // Rejection sampling of the second-order node2vec bias
+                    double bias = 1.0 / q;
+                    if (next == previous)
+                        bias = 1.0 / p;
+                    else if (this->m_graph.contains_edge_id(previous, next))
+                        bias = 1.0;
+
+                    if (rng.uniform() * max_bias < bias)
+                        break;
+                }
+
+                out[step] = next;
+                previous = current;
+                current = next;
+            }
+        }
+
+        size_t sample(size_t begin, size_t degree, internal::splitmix64& rng) const {
+            const size_t slot = rng.below(degree);
+            if (this->m_probability.empty())
+                return slot;
+
+            return rng.uniform() < this->m_probability[begin + slot] ? slot : this->m_alias[begin + slot];
+        }
+
+        const csr_graph<T>& m_graph;
+        std::vector<double> m_probability;
+        std::vector<size_t> m_alias;
+    };
+
+} // end of namespace grphx
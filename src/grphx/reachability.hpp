@@ -0,0 +1,318 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Strongly connected components with an iterative version of Tarjan's algorithm.
+     *
+     * Components are numbered in reverse topological order of the condensation: an edge between
+     * two components always goes from a higher to a lower number.
+     *
+     * @param graph The graph.
+     * @param count Receives the number of components if not null.
+     * @return The component of every vertex, indexed by dense id.
+     */
+    template<typename T>
+    std::vector<size_t> strongly_connected_components(const csr_graph<T>& graph, size_t* count = nullptr) {
+        constexpr size_t unvisited = std::numeric_limits<size_t>::max();
+        const size_t n = graph.size();
+        std::vector<size_t> component(n, unvisited);
+        std::vector<size_t> index(n, unvisited);
+        std::vector<size_t> low(n, 0);
+        std::vector<size_t> stack;
+        std::vector<std::pair<size_t, size_t>> calls; // (vertex, next edge to follow)
+        size_t next_index{ 0 };
+        size_t components{ 0 };
+
+        for (size_t root = 0; root < n; ++root) {
+            if (index[root] != unvisited)
+                continue;
+
+            calls.emplace_back(root, graph.offsets()[root]);
+            index[root] = low[root] = next_index++;
+            stack.push_back(root);
+
+            while (!calls.empty()) {
+                auto& call = calls.back();
+                const size_t v = call.first;
+                if (call.second < graph.offsets()[v + 1]) {
+                    const size_t w = graph.targets()[call.second++];
+                    if (index[w] == unvisited) {
+                        index[w] = low[w] = next_index++;
+                        stack.push_back(w);
+                        calls.emplace_back(w, graph.offsets()[w]);
+                    }
+                    else if (component[w] == unvisited) {
+                        low[v] = std::min(low[v], index[w]);
+                    }
+                    continue;
+                }
+
+                if (low[v] == index[v]) {
+                    size_t w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        component[w] = components;
+                    } while (w != v);
+                    ++components;
+                }
+
+                calls.pop_back();
+                if (!calls.empty()) {
+                    const size_t parent = calls.back().first;
+                    low[parent] = std::min(low[parent], low[v]);
+                }
+            }
+        }
+
+        if (count != nullptr)
+            *count = components;
+        return component;
+    }
+
+    /**
+     * @brief Precomputed index that answers reachability queries without a traversal.
+     *
+     * The graph is condensed into its DAG of strongly connected components, which is labeled with
+     * pruned 2-hop labels: every component gets the sorted lists of hub components that it reaches
+     * (out-labels) and that reach it (in-labels), and `u` reaches `v` exactly when the out-label of
+     * `u` and the in-label of `v` share a hub. Hubs are processed from the highest to the lowest
+     * degree product and a search from a hub stops wherever earlier hubs already answer the
+     * query, which keeps the labels small on real-world graphs. Queries between vertices whose
+     * components are in the wrong topological order are rejected before looking at the labels.
+     *
+     * The index is a snapshot; rebuild it after changing the graph.
+     */
+    template<typename T>
+    class reachability_index {
+    public:
+        using vertex_id = typename csr_graph<T>::vertex_id;
+
+        reachability_index() = default;
+
+        /**
+         * @brief Builds the index of a directed graph.
+         */
+        explicit reachability_index(const directed_graph<T>& graph) : reachability_index(csr_graph<T>(graph)) {}
+
+        /**
+         * @brief Builds the index of a CSR graph.
+         */
+        explicit reachability_index(const csr_graph<T>& graph) {
+            size_t count{ 0 };
+            this->m_component = strongly_connected_components(graph, &count);
+            this->m_index.reserve(graph.size());
+            for (size_t id = 0; id < graph.size(); ++id) {
+                this->m_index.emplace(graph.vertex_at(id), this->m_component[id]);
+            }
+
+            this->build_labels(graph, count);
+        }
+
+        /**
+         * @brief Checks if there is a path from vertex `u` to vertex `v`.
+         *
+         * Every vertex reaches itself; vertices that are not in the graph reach nothing.
+         */
+        bool reachable(const T& u, const T& v) const {
+            auto from = this->m_index.find(u);
+            auto to = this->m_index.find(v);
+            if (from == this->m_index.end() || to == this->m_index.end())
+                return false;
+
+            return this->components_reachable(from->second, to->second);
+        }
+
+        /**
+         * @brief Checks if there is a path between two vertices given by dense id of the indexed `csr_graph`.
+         */
+        bool reachable_id(vertex_id u, vertex_id v) const {
+            return this->components_reachable(this->m_component[u], this->m_component[v]);
+        }
+
+        /**
+         * @brief Returns the strongly connected component of every vertex, indexed by dense id.
+         */
+        const std::vector<size_t>& components() const {
+            return this->m_component;
+        }
+
+        /**
+         * @brief Returns the number of strongly connected components.
+         */
+        size_t component_count() const {
+            return this->m_out_offsets.empty() ? 0 : this->m_out_offsets.size() - 1;
+        }
+
+        /**
+         * @brief Returns the total number of hub entries in all labels.
+         */
+        size_t label_count() const {
+            return this->m_out_hubs.size() + this->m_in_hubs.size();
+        }
+
+        /**
+         * @brief Estimates the memory used by the index.
+         *
+         * @return The estimated heap and object footprint, broken down by purpose.
+         */
+        memory_breakdown memory_usage() const {
+            memory_breakdown usage;
+            usage.vertex_table = this->m_component.size() * sizeof(size_t);
+            usage.adjacency = (this->m_out_offsets.size() + this->m_in_offsets.size()) * sizeof(size_t)
+                + (this->m_out_hubs.size() + this->m_in_hubs.size()) * sizeof(std::uint32_t);
+            usage.indexes = internal::hash_table_size(this->m_index.bucket_count(), this->m_index.size(), sizeof(std::pair<const T, size_t>));
+            usage.overhead = sizeof(*this)
+                + (this->m_component.capacity() - this->m_component.size()) * sizeof(size_t)
+                + (this->m_out_hubs.capacity() - this->m_out_hubs.size() + this->m_in_hubs.capacity() - this->m_in_hubs.size()) * sizeof(std::uint32_t);
+
+            return usage;
+        }
+
+    private:
+        bool components_reachable(size_t from, size_t to) const {
+            if (from == to)
+                return true;
+            if (from < to)
+                return false; // Edges go from higher to lower component numbers
+
+            const std::uint32_t* out = this->m_out_hubs.data() + this->m_out_offsets[from];
+            const std::uint32_t* out_end = this->m_out_hubs.data() + this->m_out_offsets[from + 1];
+            const std::uint32_t* in = this->m_in_hubs.data() + this->m_in_offsets[to];
+            const std::uint32_t* in_end = this->m_in_hubs.data() + this->m_in_offsets[to + 1];
+            return intersects(out, out_end, in, in_end);
+        }
+
+        static bool intersects(const std::uint32_t* a, const std::uint32_t* a_end, const std::uint32_t* b, const std::uint32_t* b_end) {
+            while (a != a_end && b != b_end) {
+                if (*a == *b)
+                    return true;
+                if (*a < *b)
+                    ++a;
+                else
+                    ++b;
+            }
+            return false;
+        }
+
+        static bool intersects(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b) {
+            return intersects(a.data(), a.data() + a.size(), b.data(), b.data() + b.size());
+        }
+
+        static void flatten(const std::vector<std::vector<std::uint32_t>>& labels, std::vector<size_t>& offsets, std::vector<std::uint32_t>& hubs) {
+            offsets.assign(1, 0);
+            offsets.reserve(labels.size() + 1);
+            for (const auto& label : labels) {
+                offsets.push_back(offsets.back() + label.size());
+            }
+            hubs.reserve(offsets.back());
+            for (const auto& label : labels) {
+                hubs.insert(hubs.end(), label.begin(), label.end());
+            }
+        }
+
+        void build_labels(const csr_graph<T>& graph, size_t count) {
+            // Condensation DAG in both directions, without duplicate edges
+            std::vector<std::pair<size_t, size_t>> edges;
+            for (size_t u = 0; u < graph.size(); ++u) {
+                for (const size_t* it = graph.row_begin(u); it != graph.row_end(u); ++it) {
+                    if (this->m_component[u] != this->m_component[*it])
+                        edges.emplace_back(this->m_component[u], this->m_component[*it]);
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+            std::vector<size_t> forward_offsets(count + 1, 0);
+            std::vector<size_t> backward_offsets(count + 1, 0);
+            for (const auto& edge : edges) {
+                ++forward_offsets[edge.first + 1];
+                ++backward_offsets[edge.second + 1];
+            }
+            for (size_t c = 0; c < count; ++c) {
+                forward_offsets[c + 1] += forward_offsets[c];
+                backward_offsets[c + 1] += backward_offsets[c];
+            }
+            std::vector<size_t> forward(edges.size());
+            std::vector<size_t> backward(edges.size());
+            {
+                std::vector<size_t> forward_fill(forward_offsets.begin(), forward_offsets.end() - 1);
+                std::vector<size_t> backward_fill(backward_offsets.begin(), backward_offsets.end() - 1);
+                for (const auto& edge : edges) {
+                    forward[forward_fill[edge.first]++] = edge.second;
+                    backward[backward_fill[edge.second]++] = edge.first;
+                }
+            }
+
+            // Hubs with many paths through them go first so that they prune the later searches. Ties
+            // are broken pseudo-randomly; in topological order a long path would need a label
+            // entry per pair of its vertices.
+            std::vector<std::pair<size_t, std::uint64_t>> priority(count);
+            std::vector<size_t> order(count);
+            for (size_t c = 0; c < count; ++c) {
+                priority[c] = { (forward_offsets[c + 1] - forward_offsets[c] + 1) * (backward_offsets[c + 1] - backward_offsets[c] + 1), internal::mix64(c) };
+                order[c] = c;
+            }
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return priority[a] > priority[b]; });
+
+            std::vector<std::vector<std::uint32_t>> out_labels(count);
+            std::vector<std::vector<std::uint32_t>> in_labels(count);
+            std::vector<size_t> seen(count, std::numeric_limits<size_t>::max());
+            std::vector<size_t> queue;
+            queue.reserve(count);
+
+            auto search = [&](size_t hub, std::uint32_t rank, size_t stamp, const std::vector<size_t>& offsets, const std::vector<size_t>& targets,
+                              std::vector<std::vector<std::uint32_t>>& labels, const std::vector<std::uint32_t>& hub_label,
+                              const std::vector<std::vector<std::uint32_t>>& opposite) {
+                queue.clear();
+                queue.push_back(hub);
+                seen[hub] = stamp;
+                for (size_t head = 0; head < queue.size(); ++head) {
+                    const size_t c = queue[head];
+                    // Already answered through an earlier hub, so everything behind it is too
+                    if (c != hub && intersects(hub_label, opposite[c]))
+                        continue;
+
+                    labels[c].push_back(rank);
+                    for (size_t e = offsets[c]; e < offsets[c + 1]; ++e) {
+                        if (seen[targets[e]] != stamp) {
+                            seen[targets[e]] = stamp;
+                            queue.push_back(targets[e]);
+                        }
+                    }
+                }
+            };
+
+            for (size_t r = 0; r < count; ++r) {
+                const size_t hub = order[r];
+                const auto rank = static_cast<std::uint32_t>(r);
+                // Forward: components reached by the hub get it as an in-hub, checked against the hub's out-label
+                search(hub, rank, 2 * r, forward_offsets, forward, in_labels, out_labels[hub], in_labels);
+                search(hub, rank, 2 * r + 1, backward_offsets, backward, out_labels, in_labels[hub], out_labels);
+            }
+
+            flatten(out_labels, this->m_out_offsets, this->m_out_hubs);
+            flatten(in_labels, this->m_in_offsets, this->m_in_hubs);
+        }
+
+        std::vector<size_t> m_component;
+        std::unordered_map<T, size_t> m_index;
+        std::vector<size_t> m_out_offsets;
+        std::vector<std::uint32_t> m_out_hubs;
+        std::vector<size_t> m_in_offsets;
+        std::vector<std::uint32_t> m_in_hubs;
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+namespace grphx {
+
+    namespace internal {
+
+        /**
+         * @brief Disjoint-set forest with union by size and path halving.
+         */
+        class union_find {
+        public:
+            explicit union_find(size_t size = 0) {
+                this->reset(size);
+            }
+
+            /**
+             * @brief Puts every element of [0, size) into its own set.
+             */
+            void reset(size_t size) {
+                this->m_parent.resize(size);
+                std::iota(this->m_parent.begin(), this->m_parent.end(), size_t{ 0 });
+                this->m_size.assign(size, 1);
+                this->m_sets = size;
+            }
+
+            /**
+             * @brief Adds a new singleton set and returns its element.
+             */
+            size_t add() {
+                this->m_parent.push_back(this->m_parent.size());
+                this->m_size.push_back(1);
+                ++this->m_sets;
+                return this->m_parent.size() - 1;
+            }
+
+            /**
+             * @brief Returns the representative of the set holding `x`.
+             */
+            size_t find(size_t x) {
+                while (this->m_parent[x] != x) {
+                    this->m_parent[x] = this->m_parent[this->m_parent[x]];
+                    x = this->m_parent[x];
+                }
+                return x;
+            }
+
+            /**
+             * @brief Merges the sets holding `a` and `b`.
+             *
+             * @return False if they already were in the same set.
+             */
+            bool unite(size_t a, size_t b) {
+                a = this->find(a);
+                b = this->find(b);
+                if (a == b)
+                    return false;
+
+                if (this->m_size[a] < this->m_size[b])
+                    std::swap(a, b);
+                this->m_parent[b] = a;
+                this->m_size[a] += this->m_size[b];
+                --this->m_sets;
+                return true;
+            }
+
+            /**
+             * @brief Returns the number of elements.
+             */
+            size_t size() const {
+                return this->m_parent.size();
+            }
+
+            /**
+             * @brief Returns the number of disjoint sets.
+             */
+            size_t set_count() const {
+                return this->m_sets;
+            }
+
+        private:
+            std::vector<size_t> m_parent;
+            std::vector<size_t> m_size;
+            size_t m_sets{ 0 };
+        };
+
+        /**
+         * @brief An undirected edge between dense ids with `u <= v`, ordered by weight and then by endpoints.
+         *
+         * The total order makes the minimum spanning forest unique, so Kruskal and Borůvka agree.
+         */
+        struct mst_edge {
+            double weight;
+            size_t u;
+            size_t v;
+
+            bool operator<(const mst_edge& other) const {
+                return std::tie(this->weight, this->u, this->v) < std::tie(other.weight, other.u, other.v);
+            }
+        };
+
+    } // end of namespace internal
+
+    /**
+     * @brief The edges of a spanning forest and their total weight.
+     */
+    template<typename T>
+    struct spanning_forest {
+        std::vector<std::tuple<T, T, double>> edges; ///< The selected edges as (u, v, weight).
+        double weight{ 0.0 };                       ///< The sum of the weights of the selected edges.
+    };
+
+    namespace internal {
+
+        template<typename T>
+        spanning_forest<T> make_forest(const csr_graph<T>& graph, const std::vector<mst_edge>& selected) {
+            spanning_forest<T> forest;
+            forest.edges.reserve(selected.size());
+            for (const auto& edge : selected) {
+                forest.edges.emplace_back(graph.vertex_at(edge.u), graph.vertex_at(edge.v), edge.weight);
+                forest.weight += edge.weight;
+            }
+
+            return forest;
+        }
+
+    } // end of namespace internal
+
+    /**
+     * @brief Minimum spanning forest with Kruskal's algorithm.
+     *
+     * The edges are treated as undirected and self-loops are ignored. They are sorted with a
+     * parallel block sort and merge, then scanned once with a union-find.
+     *
+     * @param graph The graph; unweighted graphs use weight 1 for every edge.
+     * @param threads The number of threads used for sorting; 0 selects the hardware concurrency.
+     * @return The edges of a minimum spanning tree of every connected component.
+     */
+    template<typename T>
+    spanning_forest<T> minimum_spanning_forest(const csr_graph<T>& graph, size_t threads = 0) {
+        std::vector<internal::mst_edge> edges;
+        edges.reserve(graph.is_directed() ? graph.edge_count() : graph.edge_count() / 2);
+        for (size_t u = 0; u < graph.size(); ++u) {
+            for (size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+                const size_t v = graph.targets()[e];
+                // Both directions of an undirected edge are stored, keep one
+                if (u == v || (!graph.is_directed() && v < u))
+                    continue;
+
+                edges.push_back({ graph.weight(e), std::min(u, v), std::max(u, v) });
+            }
+        }
+
+        internal::parallel_sort(edges, std::less<internal::mst_edge>(), threads);
+
+        internal::union_find components(graph.size());
+        std::vector<internal::mst_edge> selected;
+        for (const auto& edge : edges) {
+            if (components.set_count() == 1)
+                break;
+            if (components.unite(edge.u, edge.v))
+                selected.push_back(edge);
+        }
+
+        return internal::make_forest(graph, selected);
+    }
+
+    /**
+     * @brief Minimum spanning forest with Borůvka's algorithm.
+     *
+     * Every round the workers scan disjoint vertex ranges for the lightest edge leaving each
+     * vertex's component. The per-vertex candidates are reduced into one array indexed by a
+     * compact component id, which shrinks with the number of components, and all of them are
+     * contracted at once, which at least halves the number of components. Directed graphs get a
+     * transposed row index once, so that every vertex also sees the edges stored in other rows.
+     * Gives the same forest as `minimum_spanning_forest`.
+     *
+     * @param graph The graph; unweighted graphs use weight 1 for every edge.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @return The edges of a minimum spanning tree of every connected component.
+     */
+    template<typename T>
+    spanning_forest<T> boruvka_minimum_spanning_forest(const csr_graph<T>& graph, size_t threads = 0) {
+        const size_t n = graph.size();
+        const internal::mst_edge none{ std::numeric_limits<double>::infinity(), n, n };
+
+        // Incoming edges of every vertex as (source, edge id), only needed when rows hold one direction
+        std::vector<size_t> in_offsets;
+        std::vector<std::pair<size_t, size_t>> in_edges;
+        if (graph.is_directed()) {
+            in_offsets.assign(n + 1, 0);
+            for (size_t e = 0; e < graph.edge_count(); ++e) {
+                ++in_offsets[graph.targets()[e] + 1];
+            }
+            for (size_t v = 0; v < n; ++v) {
+                in_offsets[v + 1] += in_offsets[v];
+            }
+            in_edges.resize(graph.edge_count());
+            std::vector<size_t> fill(in_offsets.begin(), in_offsets.end() - 1);
+            for (size_t u = 0; u < n; ++u) {
+                for (size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+                    in_edges[fill[graph.targets()[e]]++] = { u, e };
+                }
+            }
+        }
+
+        internal::union_find components(n);
+        std::vector<size_t> component(n);
+        std::vector<size_t> label(n);
+        std::vector<internal::mst_edge> vertex_best(n, none);
+        std::vector<internal::mst_edge> component_best;
+        std::vector<internal::mst_edge> selected;
+
+        for (;;) {
+            // Number the components 0, 1, ..., k - 1 so that the reduction below only needs k entries
+            size_t count{ 0 };
+            for (size_t v = 0; v < n; ++v) {
+                component[v] = components.find(v);
+                if (component[v] == v)
+                    label[v] = count++;
+            }
+            for (size_t v = 0; v < n; ++v) {
+                component[v] = label[component[v]];
+            }
+
+            internal::parallel_for(n, threads, [&](size_t, size_t begin, size_t end) {
+                for (size_t u = begin; u < end; ++u) {
+                    internal::mst_edge best = none;
+                    for (size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+                        const size_t v = graph.targets()[e];
+                        const internal::mst_edge edge{ graph.weight(e), std::min(u, v), std::max(u, v) };
+                        if (component[u] != component[v] && edge < best)
+                            best = edge;
+                    }
+                    if (graph.is_directed()) {
+                        for (size_t i = in_offsets[u]; i < in_offsets[u + 1]; ++i) {
+                            const size_t v = in_edges[i].first;
+                            const internal::mst_edge edge{ graph.weight(in_edges[i].second), std::min(u, v), std::max(u, v) };
+                            if (component[u] != component[v] && edge < best)
+                                best = edge;
+                        }
+                    }
+                    vertex_best[u] = best;
+                }
+            });
+
+            component_best.assign(count, none);
+            for (size_t u = 0; u < n; ++u) {
+                if (vertex_best[u] < component_best[component[u]])
+                    component_best[component[u]] = vertex_best[u];
+            }
+
+            bool merged = false;
+            for (const auto& best : component_best) {
+                if (best.u != n && components.unite(best.u, best.v)) {
+                    selected.push_back(best);
+                    merged = true;
+                }
+            }
+
+            if (!merged)
+                break;
+        }
+
+        std::sort(selected.begin(), selected.end());
+        return internal::make_forest(graph, selected);
+    }
+
+    /**
+     * @brief Minimum spanning forest of an undirected graph with weights supplied by a callable.
+     *
+     * @param graph The graph.
+     * @param weight Callable `double(const T& u, const T& v)` returning the weight of an edge.
+     * @param threads The number of threads; 0 selects the hardware concurrency.
+     * @return The edges of a minimum spanning tree of every connected component.
+     */
+    template<typename T, typename Weight>
+    spanning_forest<T> minimum_spanning_forest(const undirected_graph<T>& graph, Weight&& weight, size_t threads = 0) {
+        const csr_graph<T> topology(graph);
+        std::vector<std::tuple<T, T, double>> edges;
+        for (size_t u = 0; u < topology.size(); ++u) {
+            for (const size_t* it = topology.row_begin(u); it != topology.row_end(u); ++it) {
+                if (u < *it)
+                    edges.emplace_back(topology.vertex_at(u), topology.vertex_at(*it), weight(topology.vertex_at(u), topology.vertex_at(*it)));
+            }
+        }
+
+        return minimum_spanning_forest(csr_graph<T>(topology.vertices(), edges, false), threads);
+    }
+
+} // end of namespace grphx
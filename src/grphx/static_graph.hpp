@@ -0,0 +1,215 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+#include "bits.hpp"
+
+namespace grphx {
+
+    /**
+     * @brief Fixed sequence of at most `N` vertices, e.g. a traversal order.
+     */
+    template<size_t N>
+    struct vertex_sequence {
+        std::array<size_t, N> vertices{}; ///< The vertices; only the first `size` entries are used.
+        size_t size{ 0 };                 ///< The number of vertices in the sequence.
+
+        constexpr size_t operator[](size_t index) const {
+            return this->vertices[index];
+        }
+    };
+
+    /**
+     * @brief Directed graph over the vertices 0, 1, ..., N - 1 with one adjacency bit row per vertex.
+     *
+     * All storage is inline and every operation is `constexpr`, so a graph and anything derived
+     * from it, such as its transitive closure, can be computed at compile time. Edge queries are
+     * a single bit test and traversals work on whole 64-bit words. An undirected graph is stored
+     * by adding both directions of every edge.
+     *
+     * @tparam N The number of vertices.
+     */
+    template<size_t N>
+    class static_graph {
+    public:
+        static constexpr size_t words = (N + 63) / 64;
+
+        using row_type = std::array<std::uint64_t, words>;
+
+        constexpr static_graph() : m_rows{} {}
+
+        /**
+         * @brief Creates a graph from a list of directed edges.
+         *
+         * @param edges The edges as (source, destination) pairs.
+         */
+        constexpr static_graph(std::initializer_list<std::pair<size_t, size_t>> edges) : m_rows{} {
+            for (const auto& edge : edges) {
+                this->add_edge(edge.first, edge.second);
+            }
+        }
+
+        /**
+         * @brief Returns the number of vertices in the graph.
+         */
+        static constexpr size_t size() {
+            return N;
+        }
+
+        /**
+         * @brief Adds a directed edge from vertex `u` to vertex `v`; adding it twice has no effect.
+         */
+        constexpr void add_edge(size_t u, size_t v) {
+            this->m_rows[u][v / 64] |= std::uint64_t{ 1 } << (v % 64);
+        }
+
+        /**
+         * @brief Removes the directed edge from vertex `u` to vertex `v`, if any.
+         */
+        constexpr void remove_edge(size_t u, size_t v) {
+            this->m_rows[u][v / 64] &= ~(std::uint64_t{ 1 } << (v % 64));
+        }
+
+        /**
+         * @brief Checks if the graph contains a directed edge from vertex `u` to vertex `v`.
+         */
+        constexpr bool contains_edge(size_t u, size_t v) const {
+            return (this->m_rows[u][v / 64] >> (v % 64)) & 1;
+        }
+
+        /**
+         * @brief Returns the successors of a vertex as a bit row.
+         */
+        constexpr const row_type& row(size_t v) const {
+            return this->m_rows[v];
+        }
+
+        /**
+         * @brief Returns the number of edges in the graph.
+         */
+        constexpr size_t edge_count() const {
+            size_t count{ 0 };
+            for (size_t v = 0; v < N; ++v) {
+                count += this->out_degree(v);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Calculates the out-degree of a vertex.
+         */
+        constexpr size_t out_degree(size_t v) const {
+            size_t count{ 0 };
+            for (size_t w = 0; w < words; ++w) {
+                count += internal::popcount64(this->m_rows[v][w]);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Calculates the in-degree of a vertex.
+         */
+        constexpr size_t in_degree(size_t v) const {
+            size_t count{ 0 };
+            for (size_t u = 0; u < N; ++u) {
+                count += this->contains_edge(u, v);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns the set of vertices reachable from `start`, including `start`.
+         */
+        constexpr row_type reachable_from(size_t start) const {
+            row_type seen{};
+            row_type frontier{};
+            seen[start / 64] |= std::uint64_t{ 1 } << (start % 64);
+            frontier = seen;
+
+            for (bool growing = true; growing;) {
+                // Expand the whole frontier at once: next = OR of the rows of the frontier, minus seen
+                row_type next{};
+                for (size_t w = 0; w < words; ++w) {
+                    for (std::uint64_t bits = frontier[w]; bits != 0; bits &= bits - 1) {
+                        const row_type& r = this->m_rows[w * 64 + internal::lowest_bit64(bits)];
+                        for (size_t i = 0; i < words; ++i) {
+                            next[i] |= r[i];
+                        }
+                    }
+                }
+
+                growing = false;
+                for (size_t i = 0; i < words; ++i) {
+                    next[i] &= ~seen[i];
+                    seen[i] |= next[i];
+                    growing = growing || next[i] != 0;
+                }
+                frontier = next;
+            }
+
+            return seen;
+        }
+
+        /**
+         * @brief Checks if there is a path from vertex `u` to vertex `v`.
+         */
+        constexpr bool is_reachable(size_t u, size_t v) const {
+            return (this->reachable_from(u)[v / 64] >> (v % 64)) & 1;
+        }
+
+        /**
+         * @brief Breadth-First Search (BFS) algorithm.
+         *
+         * Neighbors are visited in increasing vertex order.
+         *
+         * @param start The starting vertex for BFS traversal.
+         * @return The vertices visited during BFS traversal.
+         */
+        constexpr vertex_sequence<N> bfs(size_t start) const {
+            vertex_sequence<N> order{};
+            row_type seen{};
+            seen[start / 64] |= std::uint64_t{ 1 } << (start % 64);
+            order.vertices[order.size++] = start;
+
+            for (size_t head = 0; head < order.size; ++head) {
+                const row_type& r = this->m_rows[order.vertices[head]];
+                for (size_t w = 0; w < words; ++w) {
+                    for (std::uint64_t bits = r[w] & ~seen[w]; bits != 0; bits &= bits - 1) {
+                        order.vertices[order.size++] = w * 64 + internal::lowest_bit64(bits);
+                    }
+                    seen[w] |= r[w];
+                }
+            }
+
+            return order;
+        }
+
+        /**
+         * @brief Computes the transitive closure with Warshall's algorithm on whole rows.
+         *
+         * @return A graph with an edge from `u` to `v` whenever `v` is reachable from `u` by a non-empty path.
+         */
+        constexpr static_graph transitive_closure() const {
+            static_graph closure(*this);
+            for (size_t k = 0; k < N; ++k) {
+                for (size_t i = 0; i < N; ++i) {
+                    if (closure.contains_edge(i, k)) {
+                        for (size_t w = 0; w < words; ++w) {
+                            closure.m_rows[i][w] |= closure.m_rows[k][w];
+                        }
+                    }
+                }
+            }
+
+            return closure;
+        }
+
+    private:
+        std::array<row_type, N> m_rows;
+    };
+
+} // end of namespace grphx
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "grphx/compressed_graph.hpp"
+
+// Define a test fixture for the graph
+class CompressedSuccessorsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+
+    // Every vertex links to a run of nearby vertices, like pages of the same host
+    static grphx::csr_graph<unsigned> local_graph(unsigned count) {
+        std::vector<unsigned> vertices;
+        std::vector<std::pair<unsigned, unsigned>> edges;
+        for (unsigned v = 0; v < count; ++v) {
+            vertices.push_back(v);
+            for (unsigned k = 1; k <= 8; ++k) {
+                edges.emplace_back(v, (v / 8 * 8 + k + 3) % count);
+            }
+            edges.emplace_back(v, (v * 7919) % count);
+        }
+
+        return grphx::csr_graph<unsigned>(vertices, edges);
+    }
+};
+
+TEST_F(CompressedSuccessorsTest, DecodesEveryRowExactly) {
+    const auto csr = local_graph(500);
+    grphx::compressed_graph<unsigned> compressed(csr);
+
+    ASSERT_EQ(compressed.size(), csr.size());
+    ASSERT_EQ(compressed.edge_count(), csr.edge_count());
+
+    std::vector<size_t> row;
+    for (size_t id = 0; id < csr.size(); ++id) {
+        compressed.decode(id, row);
+        ASSERT_EQ(row, std::vector<size_t>(csr.row_begin(id), csr.row_end(id)));
+        ASSERT_EQ(compressed.successors(csr.vertex_at(id)), csr.successors(csr.vertex_at(id)));
+        ASSERT_EQ(compressed.out_degree(csr.vertex_at(id)), csr.row_size(id));
+    }
+}
+
+TEST_F(CompressedSuccessorsTest, EncodingIsSmallerThanCsr) {
+    const auto csr = local_graph(1000);
+
+    grphx::compressed_graph<unsigned> with_references(csr);
+    grphx::compressed_graph<unsigned> gaps_only(csr, 0);
+
+    ASSERT_LT(with_references.encoded_size(), gaps_only.encoded_size());
+    ASSERT_LT(gaps_only.encoded_size(), csr.edge_count() * sizeof(size_t) / 4);
+    ASSERT_EQ(with_references.memory_usage().vertex_table, 0);
+}
+
+TEST_F(CompressedSuccessorsTest, SparseKeys_BfsMatchesCsr) {
+    grphx::csr_graph<long long> csr({}, { { -5, 100 }, { 100, 7 }, { 7, -5 }, { 7, 42 }, { 1000000, 7 } });
+    grphx::compressed_graph<long long> compressed(csr);
+
+    ASSERT_EQ(compressed.bfs(-5), csr.bfs(-5));
+    ASSERT_TRUE(compressed.contains_edge(7, 42));
+    ASSERT_FALSE(compressed.contains_edge(42, 7));
+    ASSERT_FALSE(compressed.contains_vertex(3));
+}
+
+TEST_F(CompressedSuccessorsTest, SharedBufferDecodesLongReferenceChains) {
+    const auto csr = local_graph(300);
+    grphx::compressed_graph<unsigned> compressed(csr, 7, 50);
+
+    std::vector<size_t> row;
+    grphx::compressed_graph<unsigned>::decode_buffer buffer;
+    for (size_t id = csr.size(); id-- > 0;) {
+        compressed.decode(id, row, buffer);
+        ASSERT_EQ(row, std::vector<size_t>(csr.row_begin(id), csr.row_end(id)));
+    }
+}
+
+TEST_F(CompressedSuccessorsTest, BuilderMatchesCsrEncoding) {
+    const auto csr = local_graph(400);
+    grphx::compressed_graph<unsigned> expected(csr);
+
+    grphx::compressed_graph<unsigned>::builder builder(csr.size());
+    for (size_t id = 0; id < csr.size(); ++id) {
+        builder.add_row(static_cast<unsigned>(id), csr.row_begin(id), csr.row_end(id));
+    }
+    const grphx::compressed_graph<unsigned> built = builder.finish();
+
+    ASSERT_EQ(built.size(), expected.size());
+    ASSERT_EQ(built.edge_count(), expected.edge_count());
+    ASSERT_EQ(built.encoded_size(), expected.encoded_size());
+
+    std::vector<size_t> row;
+    for (size_t id = 0; id < csr.size(); ++id) {
+        built.decode(id, row);
+        ASSERT_EQ(row, std::vector<size_t>(csr.row_begin(id), csr.row_end(id)));
+    }
+}
+
+TEST_F(CompressedSuccessorsTest, BuilderRejectsUnsortedOrForeignEdges) {
+    grphx::compressed_graph<int>::builder builder(4);
+    builder.add_edge(1, 3);
+
+    ASSERT_THROW(builder.add_edge(1, 2), std::invalid_argument);
+    ASSERT_THROW(builder.add_edge(0, 2), std::invalid_argument);
+    ASSERT_THROW(builder.add_edge(2, 4), std::invalid_argument);
+    ASSERT_THROW(builder.add_edge(-1, 2), std::invalid_argument);
+
+    builder.add_edge(3, 0);
+    const grphx::compressed_graph<int> graph = builder.finish();
+    ASSERT_EQ(graph.size(), 4);
+    ASSERT_EQ(graph.edge_count(), 2);
+    ASSERT_EQ(graph.bfs(1), std::vector<int>({ 1, 3, 0 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <tuple>
+#include "grphx/astar.hpp"
+
+// Define a test fixture for the graph
+class CsrAstarTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrAstarTest, ZeroHeuristic_FindsCheapestPath) {
+    grphx::csr_graph<int> graph({ 1, 2, 3, 4 }, std::vector<std::tuple<int, int, double>>{ { 1, 2, 1.0 }, { 2, 4, 5.0 }, { 1, 3, 2.0 }, { 3, 4, 1.0 } });
+
+    auto path = grphx::astar(graph, 1, 4, [](int) { return 0.0; });
+
+    ASSERT_EQ(path.vertices, (std::vector<int>{ 1, 3, 4 }));
+    ASSERT_DOUBLE_EQ(path.length, 3.0);
+}
+
+TEST_F(CsrAstarTest, GridWithManhattanHeuristic_MatchesShortestLength) {
+    const int width = 10;
+    std::vector<std::tuple<int, int, double>> edges;
+    for (int y = 0; y < width; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (x + 1 < width)
+                edges.emplace_back(y * width + x, y * width + x + 1, 1.0);
+            if (y + 1 < width)
+                edges.emplace_back(y * width + x, (y + 1) * width + x, 1.0);
+        }
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+    const int goal = width * width - 1;
+    auto manhattan = [width, goal](int v) {
+        return static_cast<double>(std::abs(v % width - goal % width) + std::abs(v / width - goal / width));
+    };
+
+    auto path = grphx::astar(graph, 0, goal, manhattan);
+
+    ASSERT_DOUBLE_EQ(path.length, 18.0);
+    ASSERT_EQ(path.vertices.size(), 19);
+    ASSERT_EQ(path.vertices.front(), 0);
+    ASSERT_EQ(path.vertices.back(), goal);
+}
+
+TEST_F(CsrAstarTest, Unreachable_ReturnsEmptyPath) {
+    grphx::csr_graph<int> graph({ 1, 2, 3 }, std::vector<std::tuple<int, int, double>>{ { 1, 2, 1.0 } });
+
+    auto path = grphx::astar(graph, 1, 3, [](int) { return 0.0; });
+
+    ASSERT_TRUE(path.vertices.empty());
+    ASSERT_TRUE(std::isinf(path.length));
+    ASSERT_TRUE(grphx::astar(graph, 1, 9, [](int) { return 0.0; }).vertices.empty());
+}
+
+TEST_F(CsrAstarTest, SourceEqualsTarget_ReturnsSingleVertex) {
+    grphx::csr_graph<int> graph({ 1, 2 }, std::vector<std::tuple<int, int, double>>{ { 1, 2, 1.0 } });
+
+    auto path = grphx::astar(graph, 1, 1, [](int) { return 0.0; });
+
+    ASSERT_EQ(path.vertices, (std::vector<int>{ 1 }));
+    ASSERT_DOUBLE_EQ(path.length, 0.0);
+}
+
+TEST_F(CsrAstarTest, ReusedWorkspace_GivesIndependentResults) {
+    grphx::csr_graph<int> graph({ 1, 2, 3, 4 }, std::vector<std::tuple<int, int, double>>{ { 1, 2, 1.0 }, { 2, 3, 1.0 }, { 3, 4, 1.0 }, { 1, 4, 10.0 } });
+    grphx::astar_workspace workspace;
+    auto zero = [](int) { return 0.0; };
+
+    for (int round = 0; round < 3; ++round) {
+        auto first = grphx::astar(graph, 1, 4, zero, workspace);
+        auto second = grphx::astar(graph, 2, 4, zero, workspace);
+        auto third = grphx::astar(graph, 4, 1, zero, workspace);
+
+        ASSERT_DOUBLE_EQ(first.length, 3.0);
+        ASSERT_EQ(second.vertices, (std::vector<int>{ 2, 3, 4 }));
+        ASSERT_TRUE(third.vertices.empty());
+    }
+}
+
+TEST_F(CsrAstarTest, CustomWeight_OverridesStoredWeights) {
+    grphx::csr_graph<int> graph({ 1, 2, 3 }, std::vector<std::tuple<int, int, double>>{ { 1, 2, 1.0 }, { 2, 3, 1.0 }, { 1, 3, 5.0 } });
+    grphx::astar_workspace workspace;
+
+    auto path = grphx::astar(graph, 1, 3, [](int) { return 0.0; }, [](size_t) { return 1.0; }, workspace);
+
+    ASSERT_EQ(path.vertices, (std::vector<int>{ 1, 3 }));
+    ASSERT_DOUBLE_EQ(path.length, 1.0);
+}
+
+TEST_F(CsrAstarTest, WeightedReorder_KeepsWeightsWithEdges) {
+    grphx::csr_graph<int> graph({ 1, 2, 3 }, std::vector<std::tuple<int, int, double>>{ { 1, 3, 7.0 }, { 1, 2, 2.0 }, { 2, 3, 3.0 } });
+
+    graph.reorder(grphx::vertex_ordering::degree);
+    auto path = grphx::astar(graph, 1, 3, [](int) { return 0.0; });
+
+    ASSERT_TRUE(graph.is_weighted());
+    ASSERT_DOUBLE_EQ(path.length, 5.0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "grphx/centrality.hpp"
+
+// Define a test fixture for the graph
+class CsrBetweennessTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrBetweennessTest, UndirectedPath_MatchesClosedForm) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 4);
+
+    auto centrality = grphx::betweenness_centrality(graph, 1);
+
+    ASSERT_DOUBLE_EQ(centrality.at(1), 0.0);
+    ASSERT_DOUBLE_EQ(centrality.at(2), 2.0);
+    ASSERT_DOUBLE_EQ(centrality.at(3), 2.0);
+    ASSERT_DOUBLE_EQ(centrality.at(4), 0.0);
+}
+
+TEST_F(CsrBetweennessTest, DirectedDiamond_SplitsShortestPaths) {
+    grphx::directed_graph<int> graph;
+    for (int v = 1; v <= 4; ++v) {
+        graph.add_vertex(v);
+    }
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(2, 4);
+    graph.add_edge(3, 4);
+
+    auto centrality = grphx::betweenness_centrality(graph, 2);
+
+    ASSERT_DOUBLE_EQ(centrality.at(1), 0.0);
+    ASSERT_DOUBLE_EQ(centrality.at(2), 0.5);
+    ASSERT_DOUBLE_EQ(centrality.at(3), 0.5);
+    ASSERT_DOUBLE_EQ(centrality.at(4), 0.0);
+}
+
+TEST_F(CsrBetweennessTest, ParallelAndSerial_Agree) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 300; ++i) {
+        edges.emplace_back(i, (i * 11 + 3) % 300);
+        edges.emplace_back(i, (i + 1) % 300);
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+
+    auto serial = grphx::betweenness_centrality(graph, 1);
+    auto parallel = grphx::betweenness_centrality(graph, 4);
+
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t v = 0; v < serial.size(); ++v) {
+        ASSERT_NEAR(serial[v], parallel[v], 1e-6 * (1.0 + serial[v]));
+    }
+}
+
+TEST_F(CsrBetweennessTest, SampledSources_EstimateExactValue) {
+    // Star: the center lies on every path between two leaves
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 1; i <= 100; ++i) {
+        edges.emplace_back(0, i);
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+
+    auto exact = grphx::betweenness_centrality(graph, 0);
+    auto estimate = grphx::betweenness_centrality(graph, 0, 50, 9);
+
+    ASSERT_DOUBLE_EQ(exact[graph.id_of(0)], 100.0 * 99.0 / 2.0);
+    ASSERT_NEAR(estimate[graph.id_of(0)], exact[graph.id_of(0)], 0.1 * exact[graph.id_of(0)]);
+    ASSERT_DOUBLE_EQ(estimate[graph.id_of(5)], 0.0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class CsrConstructionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrConstructionTest, FromDirectedGraph_PreservesEdges) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_vertex(3);
+    graph.add_edge(1, 3);
+    graph.add_edge(1, 2);
+    graph.add_edge(3, 1);
+
+    grphx::csr_graph<int> csr(graph);
+
+    ASSERT_EQ(csr.size(), 3);
+    ASSERT_EQ(csr.edge_count(), 3);
+    ASSERT_TRUE(csr.contains_edge(1, 2));
+    ASSERT_TRUE(csr.contains_edge(1, 3));
+    ASSERT_TRUE(csr.contains_edge(3, 1));
+    ASSERT_FALSE(csr.contains_edge(2, 1));
+    ASSERT_EQ(csr.out_degree(1), 2);
+    ASSERT_EQ(csr.successors(1), std::list<int>({ 2, 3 }));
+}
+
+TEST_F(CsrConstructionTest, FromUndirectedGraph_StoresBothDirections) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+
+    grphx::csr_graph<int> csr(graph);
+
+    ASSERT_FALSE(csr.is_directed());
+    ASSERT_EQ(csr.edge_count(), 4);
+    ASSERT_TRUE(csr.contains_edge(2, 1));
+    ASSERT_TRUE(csr.contains_edge(3, 2));
+}
+
+TEST_F(CsrConstructionTest, FromEdgeList_AddsMissingEndpoints) {
+    grphx::csr_graph<int> csr({ 1 }, { { 1, 2 }, { 2, 3 } });
+
+    ASSERT_EQ(csr.size(), 3);
+    ASSERT_EQ(csr.id_of(1), 0);
+    ASSERT_EQ(csr.vertex_at(csr.id_of(3)), 3);
+    ASSERT_EQ(csr.id_of(4), grphx::csr_graph<int>::npos);
+    ASSERT_EQ(csr.bfs(1), std::vector<int>({ 1, 2, 3 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
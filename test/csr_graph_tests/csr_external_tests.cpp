@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include "grphx/external.hpp"
+
+// Define a test fixture for the graph
+class CsrExternalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Tests may run in parallel processes, so every test gets its own file
+        path = ::testing::TempDir() + "grphx_" + ::testing::UnitTest::GetInstance()->current_test_info()->name()
+            + "_" + std::to_string(::getpid()) + ".csr";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    std::string path;
+};
+
+TEST_F(CsrExternalTest, RoundTripsHeader) {
+    grphx::csr_graph<int> graph({ 9 }, { { 1, 2 }, { 2, 3 } }, false);
+    grphx::write_csr_file(graph, path);
+
+    grphx::csr_file file(path);
+    ASSERT_EQ(file.size(), 4);
+    ASSERT_EQ(file.edge_count(), 4);
+    ASSERT_FALSE(file.is_directed());
+
+    size_t edges{ 0 };
+    file.for_each_edge(4096, [&](std::uint64_t u, std::uint64_t v) {
+        ASSERT_TRUE(graph.contains_edge(graph.vertex_at(u), graph.vertex_at(v)));
+        ++edges;
+    });
+    ASSERT_EQ(edges, 4);
+}
+
+TEST_F(CsrExternalTest, BfsMatchesInMemoryDistances) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 5000; ++i) {
+        edges.emplace_back(i, (i * 31 + 7) % 5000);
+        if (i % 4 == 0)
+            edges.emplace_back(i, i + 1);
+    }
+    grphx::csr_graph<int> graph({}, edges);
+    grphx::write_csr_file(graph, path);
+
+    // A tiny budget forces many buffer refills per pass
+    grphx::external_options options;
+    options.memory_budget = 32 * 1024;
+    const auto distance = grphx::external_bfs(grphx::csr_file(path), graph.id_of(0), options);
+
+    const std::vector<int> order = graph.bfs(0);
+    size_t reached{ 0 };
+    for (auto d : distance) {
+        reached += d != std::numeric_limits<std::uint32_t>::max();
+    }
+    ASSERT_EQ(reached, order.size());
+    ASSERT_EQ(distance[graph.id_of(0)], 0);
+    ASSERT_EQ(distance[graph.id_of(7)], 1);
+    ASSERT_EQ(distance[graph.id_of(1)], 1);
+    ASSERT_EQ(distance[graph.id_of(224)], 2);
+}
+
+TEST_F(CsrExternalTest, ConnectedComponentsInOnePass) {
+    grphx::csr_graph<int> graph({ 0, 1, 2, 3, 4, 5, 6 }, { { 5, 1 }, { 1, 3 }, { 4, 2 }, { 6, 6 } });
+    grphx::write_csr_file(graph, path);
+
+    const auto component = grphx::external_connected_components(grphx::csr_file(path));
+
+    ASSERT_EQ(component, std::vector<std::uint64_t>({ 0, 1, 2, 1, 2, 1, 3 }));
+}
+
+TEST_F(CsrExternalTest, RejectsBadInput) {
+    ASSERT_THROW(grphx::csr_file(path + ".missing"), std::system_error);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fputs("not a graph at all, definitely not", file);
+    std::fclose(file);
+    ASSERT_THROW(grphx::csr_file{ path }, std::runtime_error);
+
+    grphx::write_csr_file(grphx::csr_graph<int>({ 1, 2, 3 }, std::vector<std::pair<int, int>>{}), path);
+    grphx::external_options options;
+    options.memory_budget = 4;
+    ASSERT_THROW(grphx::external_bfs(grphx::csr_file(path), 0, options), std::length_error);
+}
+
+TEST_F(CsrExternalTest, RejectsCorruptRows) {
+    grphx::write_csr_file(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }), path);
+
+    // Point the first target past the last vertex
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    const std::uint64_t target = 1000;
+    std::fseek(file, static_cast<long>(sizeof(std::uint64_t) * (5 + 4)), SEEK_SET);
+    std::fwrite(&target, sizeof(target), 1, file);
+    std::fclose(file);
+    ASSERT_THROW(grphx::external_bfs(grphx::csr_file(path), 0), std::runtime_error);
+
+    // Offsets that go backwards
+    file = std::fopen(path.c_str(), "r+b");
+    const std::uint64_t offset = 2;
+    std::fseek(file, static_cast<long>(sizeof(std::uint64_t) * (5 + 1)), SEEK_SET);
+    std::fwrite(&offset, sizeof(offset), 1, file);
+    std::fclose(file);
+    ASSERT_THROW(grphx::external_connected_components(grphx::csr_file(path)), std::runtime_error);
+}
+
+TEST_F(CsrExternalTest, StreamingWriterSkipsEmptyRows) {
+    {
+        grphx::csr_file_writer writer(path, 6, true);
+        writer.add_edge(0, 5);
+        writer.add_edge(0, 1);
+        writer.add_edge(3, 4);
+        const std::vector<std::uint64_t> row{ 0, 3 };
+        writer.add_row(4, row.begin(), row.end());
+        ASSERT_THROW(writer.add_edge(2, 0), std::invalid_argument);
+        ASSERT_THROW(writer.add_edge(4, 6), std::invalid_argument);
+
+        // Not readable before it is finished
+        ASSERT_THROW(grphx::csr_file{ path }, std::runtime_error);
+        writer.finish();
+    }
+
+    grphx::csr_file file(path);
+    ASSERT_EQ(file.size(), 6);
+    ASSERT_EQ(file.edge_count(), 5);
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> edges;
+    file.for_each_edge(8, [&](std::uint64_t u, std::uint64_t v) { edges.emplace_back(u, v); });
+    ASSERT_EQ(edges, (std::vector<std::pair<std::uint64_t, std::uint64_t>>{ { 0, 5 }, { 0, 1 }, { 3, 4 }, { 4, 0 }, { 4, 3 } }));
+
+    const auto distance = grphx::external_bfs(file, 3);
+    ASSERT_EQ(distance[4], 1);
+    ASSERT_EQ(distance[5], 3);
+    ASSERT_EQ(distance[2], std::numeric_limits<std::uint32_t>::max());
+}
+
+TEST_F(CsrExternalTest, BudgetWithoutRoomForBuffersIsRejected) {
+    grphx::write_csr_file(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }), path);
+    grphx::csr_file file(path);
+
+    // 3 vertices need 24 bytes of components, which leaves 4 bytes per buffer
+    grphx::external_options options;
+    options.memory_budget = 3 * sizeof(std::uint64_t) + 8;
+    ASSERT_THROW(grphx::external_connected_components(file, options), std::length_error);
+
+    options.memory_budget = 3 * sizeof(std::uint64_t) + 16;
+    ASSERT_EQ(grphx::external_connected_components(file, options), std::vector<std::uint64_t>({ 0, 0, 0 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "grphx/delta_graph.hpp"
+
+// Define a test fixture for the graph
+class CsrMemoryUsageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrMemoryUsageTest, CsrIsSmallerThanLinkedLists) {
+    grphx::directed_graph<int> graph;
+    for (int i = 0; i < 100; ++i) {
+        graph.add_vertex(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        graph.add_edge(i, (i + 1) % 100);
+        graph.add_edge(i, (i + 7) % 100);
+    }
+
+    grphx::csr_graph<int> csr(graph);
+    csr.shrink_to_fit();
+    const auto usage = csr.memory_usage();
+
+    ASSERT_EQ(usage.vertex_table, 100 * sizeof(int));
+    ASSERT_EQ(usage.adjacency, 101 * sizeof(size_t) + 200 * sizeof(size_t));
+    ASSERT_GT(usage.indexes, 0);
+    ASSERT_LT(usage.total(), graph.memory_usage().total());
+}
+
+TEST_F(CsrMemoryUsageTest, DeltaShrinkToFit_FoldsPendingUpdates) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }));
+    graph.set_compaction_threshold(0.0);
+    graph.add_edge(3, 4);
+    graph.remove_vertex(1);
+    const auto before = graph.memory_usage();
+    ASSERT_GT(before.indexes, graph.base().memory_usage().indexes);
+
+    graph.shrink_to_fit();
+
+    ASSERT_EQ(graph.delta_size(), 0);
+    ASSERT_EQ(graph.memory_usage().adjacency, graph.base().memory_usage().adjacency);
+    ASSERT_TRUE(graph.contains_edge(3, 4));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include "grphx/astar.hpp"
+#include "grphx/properties.hpp"
+
+// Define a test fixture for the graph
+class CsrPropertyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrPropertyTest, VertexColumnsAreIndexedByDenseId) {
+    grphx::csr_graph<int> graph({}, { { 10, 20 }, { 20, 30 } });
+    grphx::vertex_property<int> depth(graph, -1);
+
+    ASSERT_EQ(depth.size(), 3);
+    depth.at(graph, 20) = 1;
+    ASSERT_EQ(depth[graph.id_of(20)], 1);
+    ASSERT_EQ(depth(graph.id_of(10)), -1);
+    ASSERT_THROW(depth.at(graph, 99), std::out_of_range);
+
+    depth.fill(0);
+    ASSERT_EQ(depth.values(), std::vector<int>({ 0, 0, 0 }));
+}
+
+TEST_F(CsrPropertyTest, EdgeColumnsAreIndexedByEdgeId) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 }, { 2, 3 } }, false);
+    grphx::edge_property<double> capacity(graph, 0.0);
+
+    ASSERT_EQ(capacity.size(), graph.edge_count());
+    capacity.at(graph, 1, 2) = 4.0;
+    ASSERT_DOUBLE_EQ(capacity[graph.find_edge(graph.id_of(1), graph.id_of(2))], 4.0);
+    ASSERT_DOUBLE_EQ(capacity.at(graph, 2, 1), 0.0);
+    ASSERT_THROW(capacity.at(graph, 1, 3), std::out_of_range);
+}
+
+TEST_F(CsrPropertyTest, EdgePropertyDrivesAStar) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 }, { 2, 4 }, { 1, 3 }, { 3, 4 } });
+    grphx::edge_property<double> cost(graph, 1.0);
+    cost.at(graph, 1, 2) = 10.0;
+
+    grphx::astar_workspace workspace;
+    auto path = grphx::astar(graph, 1, 4, [](int) { return 0.0; }, cost, workspace);
+
+    ASSERT_EQ(path.vertices, std::vector<int>({ 1, 3, 4 }));
+    ASSERT_DOUBLE_EQ(path.length, 2.0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include "grphx/random_walk.hpp"
+
+// Define a test fixture for the graph
+class CsrRandomWalkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrRandomWalkTest, Walks_FollowEdgesAndUseLayout) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 50; ++i) {
+        edges.emplace_back(i, (i + 1) % 50);
+        edges.emplace_back(i, (i * 7 + 3) % 50);
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+    grphx::random_walker<int> walker(graph);
+
+    auto walks = walker.random_walks({ 0, 10, 20 }, 8, 4, 1.0, 1.0, 2, 1);
+
+    ASSERT_EQ(walks.size(), 3 * 4 * 8);
+    for (size_t w = 0; w < 12; ++w) {
+        ASSERT_EQ(walks[w * 8], graph.id_of(w / 4 * 10));
+        for (size_t step = 1; step < 8; ++step) {
+            ASSERT_TRUE(graph.contains_edge_id(walks[w * 8 + step - 1], walks[w * 8 + step]));
+        }
+    }
+}
+
+TEST_F(CsrRandomWalkTest, SameSeed_SameWalksForAnyThreadCount) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 200; ++i) {
+        edges.emplace_back(i, (i * 13 + 1) % 200);
+        edges.emplace_back(i, (i * 17 + 5) % 200);
+        edges.emplace_back(i, (i + 1) % 200);
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+    grphx::random_walker<int> walker(graph);
+    std::vector<int> starts{ 0, 5, 50, 150 };
+
+    auto serial = walker.random_walks(starts, 20, 5, 0.5, 2.0, 1, 42);
+    auto parallel = walker.random_walks(starts, 20, 5, 0.5, 2.0, 4, 42);
+    auto other = walker.random_walks(starts, 20, 5, 0.5, 2.0, 4, 43);
+
+    ASSERT_EQ(serial, parallel);
+    ASSERT_NE(serial, other);
+}
+
+TEST_F(CsrRandomWalkTest, DeadEndAndUnknownStart_ArePadded) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 } });
+    grphx::random_walker<int> walker(graph);
+    const auto npos = grphx::random_walker<int>::npos;
+
+    auto walks = walker.random_walks({ 1, 9 }, 4);
+
+    ASSERT_EQ(walks, std::vector<size_t>({ graph.id_of(1), graph.id_of(2), npos, npos, npos, npos, npos, npos }));
+}
+
+TEST_F(CsrRandomWalkTest, WeightedGraph_FollowsAliasDistribution) {
+    grphx::csr_graph<int> graph({ 0, 1, 2 }, std::vector<std::tuple<int, int, double>>{ { 0, 1, 9.0 }, { 0, 2, 1.0 }, { 1, 0, 1.0 }, { 2, 0, 1.0 } });
+    grphx::random_walker<int> walker(graph);
+
+    auto walks = walker.random_walks({ 0 }, 2, 10000, 1.0, 1.0, 0, 3);
+
+    size_t heavy{ 0 };
+    for (size_t w = 0; w < 10000; ++w) {
+        heavy += walks[w * 2 + 1] == graph.id_of(1);
+    }
+    ASSERT_NEAR(static_cast<double>(heavy) / 10000.0, 0.9, 0.02);
+}
+
+TEST_F(CsrRandomWalkTest, LowReturnParameter_FavorsBacktracking) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 1; i <= 10; ++i) {
+        edges.emplace_back(0, i);
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+    grphx::random_walker<int> walker(graph);
+
+    auto walks = walker.random_walks({ 1 }, 3, 2000, 0.05, 1.0, 0, 5);
+
+    size_t returned{ 0 };
+    for (size_t w = 0; w < 2000; ++w) {
+        returned += walks[w * 3 + 2] == walks[w * 3];
+    }
+    // Returning weighs 1 / p = 20 against 1 for each of the 9 other leaves
+    ASSERT_NEAR(static_cast<double>(returned) / 2000.0, 20.0 / 29.0, 0.04);
+}
+
+TEST_F(CsrRandomWalkTest, InvalidBiasParameters_Throw) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 }, { 2, 1 } });
+    grphx::random_walker<int> walker(graph);
+    std::vector<size_t> buffer(4);
+
+    ASSERT_THROW(walker.random_walks({ 1 }, 4, 1, 0.0, 1.0), std::invalid_argument);
+    ASSERT_THROW(walker.random_walks({ 1 }, 4, 1, 1.0, 0.0), std::invalid_argument);
+    ASSERT_THROW(walker.random_walks({ 1 }, 4, 1, -1.0, 1.0), std::invalid_argument);
+    ASSERT_THROW(walker.random_walks({ 1 }, 4, 1, 1.0, std::numeric_limits<double>::infinity()), std::invalid_argument);
+    ASSERT_THROW(walker.random_walks_into({ 1 }, 4, 1, std::nan(""), 1.0, buffer.data()), std::invalid_argument);
+    ASSERT_NO_THROW(walker.random_walks({ 1 }, 4, 1, 0.25, 4.0));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <unordered_set>
+#include <utility>
+#include "grphx/reachability.hpp"
+
+// Define a test fixture for the graph
+class CsrReachabilityTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrReachabilityTest, StronglyConnectedComponents_ReverseTopologicalOrder) {
+    grphx::csr_graph<int> graph({ 6 }, std::vector<std::pair<int, int>>{
+        { 1, 2 }, { 2, 3 }, { 3, 1 }, { 3, 4 }, { 4, 5 }, { 5, 4 } });
+
+    size_t count{ 0 };
+    auto component = grphx::strongly_connected_components(graph, &count);
+    auto of = [&](int v) { return component[graph.id_of(v)]; };
+
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(of(1), of(2));
+    ASSERT_EQ(of(2), of(3));
+    ASSERT_EQ(of(4), of(5));
+    ASSERT_GT(of(1), of(4));
+    ASSERT_NE(of(6), of(1));
+}
+
+TEST_F(CsrReachabilityTest, AnswersAcrossCycles) {
+    grphx::directed_graph<int> graph;
+    for (int i = 1; i <= 6; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 1);
+    graph.add_edge(3, 4);
+    graph.add_edge(4, 5);
+
+    grphx::reachability_index<int> index(graph);
+
+    ASSERT_TRUE(index.reachable(2, 1));
+    ASSERT_TRUE(index.reachable(1, 5));
+    ASSERT_TRUE(index.reachable(6, 6));
+    ASSERT_FALSE(index.reachable(5, 1));
+    ASSERT_FALSE(index.reachable(1, 6));
+    ASSERT_FALSE(index.reachable(1, 42));
+    ASSERT_EQ(index.component_count(), 4);
+}
+
+TEST_F(CsrReachabilityTest, MatchesTraversalOnLargeGraph) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 400; ++i) {
+        edges.emplace_back(i, (i * 37 + 11) % 400);
+        if (i % 3 == 0)
+            edges.emplace_back(i, (i * 13 + 5) % 400);
+        if (i % 50 == 0)
+            edges.emplace_back((i + 7) % 400, i);
+    }
+    grphx::csr_graph<int> graph({}, edges);
+    grphx::reachability_index<int> index(graph);
+
+    for (int u = 0; u < 400; u += 7) {
+        const std::vector<int> order = graph.bfs(u);
+        const std::unordered_set<int> reached(order.begin(), order.end());
+        for (int v = 0; v < 400; ++v) {
+            ASSERT_EQ(index.reachable(u, v), reached.count(v) == 1) << u << " -> " << v;
+        }
+    }
+    ASSERT_GT(index.memory_usage().total(), 0);
+}
+
+TEST_F(CsrReachabilityTest, ChainLabelsStaySmall) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 1000; ++i) {
+        edges.emplace_back(i, i + 1);
+    }
+    grphx::csr_graph<int> graph({}, edges);
+    grphx::reachability_index<int> index(graph);
+
+    ASSERT_TRUE(index.reachable_id(graph.id_of(0), graph.id_of(1000)));
+    ASSERT_FALSE(index.reachable(1000, 0));
+    ASSERT_LT(index.label_count(), 30000);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
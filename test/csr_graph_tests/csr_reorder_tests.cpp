@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class CsrReorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrReorderTest, BfsOrdering_RelabelsInDiscoveryOrder) {
+    grphx::csr_graph<int> graph({ 4, 3, 2, 1 }, { { 4, 1 }, { 1, 2 }, { 2, 3 } });
+
+    graph.reorder(grphx::vertex_ordering::bfs);
+
+    ASSERT_EQ(graph.id_of(4), 0);
+    ASSERT_EQ(graph.id_of(1), 1);
+    ASSERT_EQ(graph.id_of(2), 2);
+    ASSERT_EQ(graph.id_of(3), 3);
+    ASSERT_EQ(graph.vertex_at(1), 1);
+}
+
+TEST_F(CsrReorderTest, AllStrategies_PreserveEdges) {
+    const std::vector<std::pair<int, int>> edges{ { 1, 2 }, { 1, 3 }, { 2, 4 }, { 3, 4 }, { 4, 5 }, { 6, 7 } };
+
+    for (auto strategy : { grphx::vertex_ordering::degree, grphx::vertex_ordering::reverse_cuthill_mckee, grphx::vertex_ordering::bfs }) {
+        grphx::csr_graph<int> graph({}, edges, false);
+        graph.reorder(strategy);
+
+        ASSERT_EQ(graph.size(), 7);
+        ASSERT_EQ(graph.edge_count(), 2 * edges.size());
+        for (const auto& edge : edges) {
+            ASSERT_TRUE(graph.contains_edge(edge.first, edge.second));
+            ASSERT_TRUE(graph.contains_edge(edge.second, edge.first));
+        }
+        ASSERT_FALSE(graph.contains_edge(1, 4));
+    }
+}
+
+TEST_F(CsrReorderTest, ReverseCuthillMcKee_ReducesBandwidth) {
+    // A path whose vertices were inserted in a scattered order
+    grphx::csr_graph<int> graph({ 0, 5, 1, 4, 2, 3 }, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 }, { 4, 5 } }, false);
+
+    auto bandwidth = [&graph]() {
+        size_t result = 0;
+        for (size_t id = 0; id < graph.size(); ++id) {
+            for (const size_t* it = graph.row_begin(id); it != graph.row_end(id); ++it) {
+                result = std::max(result, id > *it ? id - *it : *it - id);
+            }
+        }
+        return result;
+    };
+
+    const size_t before = bandwidth();
+    graph.reorder(grphx::vertex_ordering::reverse_cuthill_mckee);
+
+    ASSERT_LT(bandwidth(), before);
+    ASSERT_EQ(bandwidth(), 1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
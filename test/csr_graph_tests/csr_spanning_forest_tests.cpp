@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include "grphx/spanning_tree.hpp"
+
+// Define a test fixture for the graph
+class CsrSpanningForestTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrSpanningForestTest, Kruskal_SelectsLightestTree) {
+    grphx::csr_graph<int> graph({}, std::vector<std::tuple<int, int, double>>{
+        { 1, 2, 1.0 }, { 2, 3, 2.0 }, { 1, 3, 3.0 }, { 3, 4, 4.0 }, { 2, 4, 5.0 } }, false);
+
+    auto forest = grphx::minimum_spanning_forest(graph, 1);
+
+    ASSERT_EQ(forest.edges.size(), 3);
+    ASSERT_DOUBLE_EQ(forest.weight, 7.0);
+    ASSERT_EQ(std::get<0>(forest.edges[2]), 3);
+    ASSERT_EQ(std::get<1>(forest.edges[2]), 4);
+}
+
+TEST_F(CsrSpanningForestTest, DisconnectedGraph_ReturnsForest) {
+    grphx::csr_graph<int> graph({ 9 }, std::vector<std::tuple<int, int, double>>{
+        { 1, 2, 1.0 }, { 2, 3, 1.0 }, { 3, 1, 1.0 }, { 5, 6, 2.0 }, { 6, 6, 0.5 } }, false);
+
+    auto kruskal = grphx::minimum_spanning_forest(graph);
+    auto boruvka = grphx::boruvka_minimum_spanning_forest(graph);
+
+    ASSERT_EQ(kruskal.edges.size(), 3);
+    ASSERT_DOUBLE_EQ(kruskal.weight, 4.0);
+    ASSERT_EQ(boruvka.edges, kruskal.edges);
+}
+
+TEST_F(CsrSpanningForestTest, Boruvka_MatchesKruskalOnLargeGraph) {
+    std::vector<std::tuple<int, int, double>> edges;
+    for (int i = 0; i < 3000; ++i) {
+        edges.emplace_back(i, (i * 17 + 3) % 3000, static_cast<double>((i * 7919) % 101));
+        edges.emplace_back(i, (i + 1) % 3000, static_cast<double>((i * 104729) % 97));
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+
+    auto kruskal = grphx::minimum_spanning_forest(graph, 4);
+    auto boruvka = grphx::boruvka_minimum_spanning_forest(graph, 4);
+    auto serial = grphx::boruvka_minimum_spanning_forest(graph, 1);
+
+    ASSERT_EQ(kruskal.edges.size(), 2999);
+    ASSERT_DOUBLE_EQ(kruskal.weight, boruvka.weight);
+    ASSERT_EQ(kruskal.edges, boruvka.edges);
+    ASSERT_EQ(serial.edges, boruvka.edges);
+}
+
+TEST_F(CsrSpanningForestTest, Boruvka_SeesIncomingEdgesOfDirectedGraph) {
+    // Vertex 0 has no out-edges, so its component only finds its lightest edge through the in-edges
+    std::vector<std::tuple<int, int, double>> edges;
+    for (int i = 1; i < 500; ++i) {
+        edges.emplace_back(i, 0, static_cast<double>((i * 37) % 11));
+        edges.emplace_back(i, (i * 13) % 500, static_cast<double>((i * 53) % 7));
+    }
+    grphx::csr_graph<int> graph({}, edges, true);
+
+    auto kruskal = grphx::minimum_spanning_forest(graph, 2);
+    auto boruvka = grphx::boruvka_minimum_spanning_forest(graph, 3);
+
+    ASSERT_EQ(kruskal.edges.size(), 499);
+    ASSERT_EQ(kruskal.edges, boruvka.edges);
+}
+
+TEST_F(CsrSpanningForestTest, UndirectedGraph_UsesWeightCallable) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(1, 3);
+
+    auto forest = grphx::minimum_spanning_forest(graph, [](int u, int v) { return static_cast<double>(u * v); });
+
+    ASSERT_EQ(forest.edges.size(), 2);
+    ASSERT_DOUBLE_EQ(forest.weight, 2.0 + 3.0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
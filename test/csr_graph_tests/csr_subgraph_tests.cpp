@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class CsrSubgraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CsrSubgraphTest, InducedSubgraph_KeepsInternalEdgesAndRelabels) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 }, { 2, 3 }, { 3, 1 }, { 3, 4 } });
+
+    auto subgraph = graph.induced_subgraph({ 3, 1, 9, 1 });
+
+    ASSERT_EQ(subgraph.size(), 2);
+    ASSERT_EQ(subgraph.id_of(3), 0);
+    ASSERT_EQ(subgraph.id_of(1), 1);
+    ASSERT_EQ(subgraph.edge_count(), 1);
+    ASSERT_TRUE(subgraph.contains_edge(3, 1));
+    ASSERT_FALSE(subgraph.contains_vertex(4));
+}
+
+TEST_F(CsrSubgraphTest, KHopNeighborhood_OrdersSeedsThenHops) {
+    grphx::csr_graph<int> graph({}, { { 1, 2 }, { 2, 3 }, { 3, 4 }, { 10, 11 }, { 11, 12 } });
+
+    auto neighborhood = graph.k_hop_neighborhood({ 10, 1 }, 2);
+
+    ASSERT_EQ(neighborhood.vertices(), std::vector<int>({ 10, 1, 2, 11, 3, 12 }));
+    ASSERT_EQ(neighborhood.edge_count(), 4);
+    ASSERT_FALSE(neighborhood.contains_vertex(4));
+}
+
+TEST_F(CsrSubgraphTest, KHopNeighborhood_FanoutLimitsExpansion) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 1; i <= 100; ++i) {
+        edges.emplace_back(0, i);
+        edges.emplace_back(i, 1000 + i);
+    }
+    grphx::csr_graph<int> graph({}, edges);
+
+    auto neighborhood = graph.k_hop_neighborhood({ 0 }, 2, { 5, 1 });
+
+    ASSERT_EQ(neighborhood.size(), 11);
+    ASSERT_EQ(neighborhood.out_degree(0), 5);
+}
+
+TEST_F(CsrSubgraphTest, KHopNeighborhood_IndependentOfThreadCount) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 500; ++i) {
+        edges.emplace_back(i, (i * 7 + 1) % 500);
+        edges.emplace_back(i, (i * 13 + 5) % 500);
+        edges.emplace_back(i, (i * 31 + 11) % 500);
+    }
+    grphx::csr_graph<int> graph({}, edges);
+    std::vector<int> seeds{ 0, 17, 42, 99, 250, 444 };
+
+    auto serial = graph.k_hop_neighborhood(seeds, 3, { 2, 2, 2 }, 1, 7);
+    auto parallel = graph.k_hop_neighborhood(seeds, 3, { 2, 2, 2 }, 4, 7);
+
+    ASSERT_EQ(serial.vertices(), parallel.vertices());
+    ASSERT_EQ(serial.targets(), parallel.targets());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "grphx/delta_graph.hpp"
+
+// Define a test fixture for the graph
+class DeltaPropertyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(DeltaPropertyTest, FollowsInsertionsAndRemovals) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }));
+    graph.set_compaction_threshold(0.0);
+    graph.set_tombstone_threshold(0.0);
+    auto& rank = graph.add_vertex_property<double>(1.0);
+
+    ASSERT_EQ(rank.size(), 3);
+    rank.at(graph, 2) = 5.0;
+
+    graph.add_edge(3, 4);
+    ASSERT_EQ(rank.size(), 4);
+    ASSERT_DOUBLE_EQ(rank[graph.id_of(4)], 1.0);
+
+    const auto removed = graph.id_of(2);
+    graph.remove_vertex(2);
+    ASSERT_DOUBLE_EQ(rank[removed], 1.0);
+    ASSERT_THROW(rank.at(graph, 2), std::out_of_range);
+}
+
+TEST_F(DeltaPropertyTest, SurvivesCompaction) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 }, { 3, 1 } }));
+    graph.set_compaction_threshold(0.0);
+    graph.set_tombstone_threshold(0.0);
+    auto& name = graph.add_vertex_property<std::string>();
+    auto& seen = graph.add_vertex_property<bool>(false);
+
+    name.at(graph, 1) = "one";
+    name.at(graph, 3) = "three";
+    graph.add_edge(3, 7);
+    name.at(graph, 7) = "seven";
+    seen.at(graph, 7) = true;
+    graph.remove_vertex(2);
+    graph.compact();
+
+    ASSERT_EQ(name.size(), 3);
+    ASSERT_EQ(name.at(graph, 1), "one");
+    ASSERT_EQ(name.at(graph, 3), "three");
+    ASSERT_EQ(name.at(graph, 7), "seven");
+    ASSERT_TRUE(seen.at(graph, 7));
+    ASSERT_FALSE(seen.at(graph, 1));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
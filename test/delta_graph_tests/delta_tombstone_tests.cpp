@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "grphx/delta_graph.hpp"
+
+// Define a test fixture for the graph
+class DeltaTombstoneTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(DeltaTombstoneTest, RemovedEdgesAndVerticesAreSkipped) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 1, 3 }, { 1, 4 }, { 4, 1 } }));
+    graph.set_tombstone_threshold(0.0);
+
+    graph.remove_edge(1, 3);
+    graph.remove_vertex(4);
+
+    ASSERT_EQ(graph.successors(1), std::list<int>({ 2 }));
+    ASSERT_EQ(graph.out_degree(1), 1);
+    ASSERT_EQ(graph.bfs(1), std::vector<int>({ 1, 2 }));
+    ASSERT_GT(graph.tombstone_ratio(), 0.0);
+}
+
+TEST_F(DeltaTombstoneTest, RemovingTwice_CountsOneTombstone) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }));
+    graph.set_tombstone_threshold(0.0);
+
+    graph.remove_edge(1, 2);
+    graph.remove_edge(1, 2);
+    graph.remove_vertex(3);
+    graph.remove_vertex(3);
+
+    ASSERT_EQ(graph.delta_size(), 2);
+    ASSERT_EQ(graph.size(), 2);
+}
+
+TEST_F(DeltaTombstoneTest, RestoredBaseEdge_ClearsTombstone) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 } }));
+    graph.set_tombstone_threshold(0.0);
+
+    graph.remove_edge(1, 2);
+    graph.add_edge(1, 2);
+
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_EQ(graph.delta_size(), 0);
+    ASSERT_EQ(graph.tombstone_ratio(), 0.0);
+}
+
+TEST_F(DeltaTombstoneTest, TombstoneThreshold_TriggersCompaction) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 4000; ++i) {
+        edges.emplace_back(i, i + 1);
+    }
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, edges));
+    graph.set_compaction_threshold(0.0);
+    graph.set_tombstone_threshold(0.25);
+
+    for (int i = 0; i < 3000; ++i) {
+        graph.remove_vertex(i);
+    }
+
+    ASSERT_LT(graph.base().size(), 4001);
+    ASSERT_LT(graph.tombstone_ratio(), 0.25);
+    ASSERT_EQ(graph.size(), 1001);
+    ASSERT_TRUE(graph.contains_edge(3000, 3001));
+    ASSERT_FALSE(graph.contains_vertex(10));
+}
+
+TEST_F(DeltaTombstoneTest, ChurnOfDeltaVertices_KeepsSizeConsistent) {
+    grphx::delta_graph<int> graph;
+    graph.set_compaction_threshold(0.0);
+
+    for (int round = 0; round < 100; ++round) {
+        graph.add_edge(round, round + 1000);
+        graph.remove_vertex(round);
+    }
+
+    ASSERT_EQ(graph.size(), 100);
+    ASSERT_TRUE(graph.successors(1050).empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
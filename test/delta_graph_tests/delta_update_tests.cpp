@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "grphx/delta_graph.hpp"
+
+// Define a test fixture for the graph
+class DeltaUpdateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(DeltaUpdateTest, InsertionsAreMergedWithBase) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }));
+    graph.add_edge(1, 3);
+    graph.add_edge(3, 4);
+
+    ASSERT_EQ(graph.size(), 4);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_TRUE(graph.contains_edge(1, 3));
+    ASSERT_TRUE(graph.contains_edge(3, 4));
+    ASSERT_EQ(graph.out_degree(1), 2);
+    ASSERT_EQ(graph.bfs(1), std::vector<int>({ 1, 2, 3, 4 }));
+}
+
+TEST_F(DeltaUpdateTest, DeletionsHideBaseEdges) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 1, 3 }, { 3, 1 } }));
+    graph.remove_edge(1, 2);
+    graph.remove_vertex(3);
+
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_vertex(3));
+    ASSERT_TRUE(graph.successors(1).empty());
+    ASSERT_EQ(graph.size(), 2);
+
+    // Re-adding a removed vertex must not resurrect its old edges
+    graph.add_vertex(3);
+    ASSERT_FALSE(graph.contains_edge(1, 3));
+    graph.add_edge(1, 2);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+}
+
+TEST_F(DeltaUpdateTest, CompactFoldsDeltaIntoBase) {
+    grphx::delta_graph<int> graph(grphx::csr_graph<int>({}, { { 1, 2 }, { 2, 3 } }));
+    graph.set_compaction_threshold(0.0);
+    graph.add_edge(3, 1);
+    graph.remove_edge(1, 2);
+    graph.remove_vertex(2);
+    ASSERT_EQ(graph.delta_size(), 3);
+
+    graph.compact();
+
+    ASSERT_EQ(graph.delta_size(), 0);
+    ASSERT_EQ(graph.base().size(), 2);
+    ASSERT_EQ(graph.base().edge_count(), 1);
+    ASSERT_TRUE(graph.contains_edge(3, 1));
+    ASSERT_FALSE(graph.contains_vertex(2));
+}
+
+TEST_F(DeltaUpdateTest, ThresholdTriggersAutomaticCompaction) {
+    grphx::delta_graph<int> graph;
+    for (int i = 0; i < 2000; ++i) {
+        graph.add_edge(i, i + 1);
+    }
+
+    ASSERT_GT(graph.base().edge_count(), 0);
+    ASSERT_LT(graph.delta_size(), 2000);
+    ASSERT_EQ(graph.size(), 2001);
+    ASSERT_TRUE(graph.contains_edge(1999, 2000));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
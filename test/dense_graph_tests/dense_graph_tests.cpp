@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <vector>
+#include "grphx/dense_graph.hpp"
+#include "grphx/parallel.hpp"
+
+// Define a test fixture for the graph
+class DenseGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(DenseGraphTest, DirectedEdges) {
+    grphx::dense_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(3, 2);
+
+    ASSERT_EQ(graph.size(), 3);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+    ASSERT_FALSE(graph.contains_edge(1, 4));
+    ASSERT_EQ(graph.out_degree(1), 2);
+    ASSERT_EQ(graph.in_degree(2), 2);
+    ASSERT_EQ(graph.predecessors(2), std::list<int>({ 1, 3 }));
+
+    graph.remove_edge(1, 2);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    ASSERT_EQ(graph.in_degree(2), 1);
+}
+
+TEST_F(DenseGraphTest, UndirectedEdges) {
+    grphx::dense_graph<int> graph(false);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+
+    ASSERT_TRUE(graph.contains_edge(2, 1));
+    ASSERT_EQ(graph.degree(2), 2);
+    ASSERT_EQ(graph.in_degree(2), 2);
+    ASSERT_EQ(graph.neighbors(2), std::list<int>({ 1, 3 }));
+}
+
+TEST_F(DenseGraphTest, RemoveVertexReusesSlot) {
+    grphx::dense_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 2);
+    graph.remove_vertex(2);
+
+    ASSERT_EQ(graph.size(), 2);
+    ASSERT_FALSE(graph.contains_vertex(2));
+    ASSERT_EQ(graph.out_degree(1), 0);
+    ASSERT_EQ(graph.in_degree(3), 0);
+
+    graph.add_edge(4, 3);
+    ASSERT_TRUE(graph.contains_edge(4, 3));
+    ASSERT_FALSE(graph.contains_edge(4, 1));
+    ASSERT_EQ(graph.in_degree(3), 1);
+    ASSERT_EQ(graph.in_degree(4), 0);
+}
+
+TEST_F(DenseGraphTest, GrowsPastOneWord) {
+    grphx::dense_graph<int> graph;
+    for (int v = 1; v < 200; ++v) {
+        graph.add_edge(0, v);
+        graph.add_edge(v, (v + 1) % 200);
+    }
+
+    ASSERT_EQ(graph.size(), 200);
+    ASSERT_EQ(graph.out_degree(0), 199);
+    ASSERT_EQ(graph.in_degree(150), 2);
+    ASSERT_TRUE(graph.contains_edge(199, 0));
+    ASSERT_EQ(graph.common_neighbors(0, 10), 1);
+}
+
+TEST_F(DenseGraphTest, CommonNeighbors) {
+    grphx::dense_graph<int> graph(false);
+    for (int v = 2; v < 10; ++v) {
+        graph.add_edge(0, v);
+        if (v % 2 == 0)
+            graph.add_edge(1, v);
+    }
+
+    ASSERT_EQ(graph.common_neighbors(0, 1), 4);
+    ASSERT_EQ(graph.common_neighbors(0, 42), 0);
+}
+
+TEST_F(DenseGraphTest, BfsVisitsLevelByLevel) {
+    grphx::dense_graph<int> graph;
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 0);
+    graph.add_vertex(5);
+
+    ASSERT_EQ(graph.bfs(0), std::vector<int>({ 0, 1, 2, 3 }));
+    ASSERT_EQ(graph.bfs(5), std::vector<int>({ 5 }));
+    ASSERT_TRUE(graph.bfs(42).empty());
+}
+
+TEST_F(DenseGraphTest, CopiesListGraphs) {
+    grphx::directed_graph<int> directed;
+    directed.add_vertex(1);
+    directed.add_vertex(2);
+    directed.add_vertex(3);
+    directed.add_edge(1, 2);
+    directed.add_edge(2, 3);
+    grphx::undirected_graph<int> undirected;
+    undirected.add_edge(1, 2);
+
+    grphx::dense_graph<int> from_directed(directed);
+    grphx::dense_graph<int> from_undirected(undirected);
+
+    ASSERT_TRUE(from_directed.is_directed());
+    ASSERT_TRUE(from_directed.contains_edge(2, 3));
+    ASSERT_FALSE(from_directed.contains_edge(3, 2));
+    ASSERT_FALSE(from_undirected.is_directed());
+    ASSERT_TRUE(from_undirected.contains_edge(2, 1));
+}
+
+TEST_F(DenseGraphTest, MemoryUsage) {
+    grphx::dense_graph<int> graph;
+    graph.add_edge(1, 2);
+
+    const grphx::memory_breakdown usage = graph.memory_usage();
+    // 64 reserved slots, one word per row, rows and columns
+    ASSERT_EQ(usage.adjacency, 2 * 64 * sizeof(std::uint64_t));
+    ASSERT_GT(usage.indexes, 0);
+}
+
+TEST_F(DenseGraphTest, PopcountDispatchMatchesPortableCount) {
+    std::vector<std::uint64_t> words(37);
+    std::vector<std::uint64_t> mask(37);
+    for (size_t w = 0; w < words.size(); ++w) {
+        words[w] = grphx::internal::mix64(w);
+        mask[w] = grphx::internal::mix64(w + 1000);
+    }
+    words[3] = ~std::uint64_t{ 0 };
+    mask[3] = ~std::uint64_t{ 0 };
+
+    size_t expected{ 0 };
+    size_t expected_masked{ 0 };
+    for (size_t w = 0; w < words.size(); ++w) {
+        expected += grphx::internal::popcount64(words[w]);
+        expected_masked += grphx::internal::popcount64(words[w] & mask[w]);
+    }
+
+    ASSERT_EQ(grphx::internal::popcount_words(words.data(), nullptr, words.size()), expected);
+    ASSERT_EQ(grphx::internal::popcount_words(words.data(), mask.data(), words.size()), expected_masked);
+    ASSERT_EQ(grphx::internal::popcount_words_generic(words.data(), mask.data(), words.size()), expected_masked);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
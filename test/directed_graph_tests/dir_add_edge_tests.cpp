@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <string>
 #include "grphx/grphx.hpp"
 
 // Define a test fixture for the graph
@@ -52,6 +53,46 @@ TEST_F(AddEdgeTest, AddDuplicateEdgeTest) {
     ASSERT_FALSE(graph.contains_edge(2, 1));
 }
 
+TEST_F(AddEdgeTest, AddEdgesInBulk_MatchesSingleInsertions) {
+    grphx::directed_graph<std::string> bulk;
+    grphx::directed_graph<std::string> single;
+    std::vector<std::pair<std::string, std::string>> edges;
+    for (int i = 0; i < 200; ++i) {
+        edges.emplace_back(std::to_string(i % 50), std::to_string((i * 7) % 50));
+    }
+    edges.emplace_back("missing", "0");
+
+    std::vector<std::string> vertices;
+    for (int i = 0; i < 50; ++i) {
+        vertices.push_back(std::to_string(i));
+        single.add_vertex(std::to_string(i));
+    }
+    bulk.add_vertices(vertices);
+    bulk.add_edges(edges);
+    for (const auto& edge : edges) {
+        single.add_edge(edge.first, edge.second);
+    }
+
+    ASSERT_EQ(bulk.size(), 50);
+    ASSERT_FALSE(bulk.contains_vertex("missing"));
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_EQ(bulk.successors(std::to_string(i)), single.successors(std::to_string(i)));
+    }
+    ASSERT_FALSE(bulk.has_edge_index()); // The temporary duplicate index is dropped again
+}
+
+TEST_F(AddEdgeTest, AddEdgesInBulk_StartsOneGeneration) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertices({ 1, 2, 3 });
+    const auto before = graph.generation();
+
+    graph.add_edges({ { 1, 2 }, { 2, 3 }, { 3, 1 } });
+    ASSERT_EQ(graph.generation(), before + 1);
+
+    graph.add_edges({ { 1, 2 }, { 4, 1 } }); // A duplicate and a missing source change nothing
+    ASSERT_EQ(graph.generation(), before + 1);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include "grphx/async.hpp"
+
+// Define a test fixture for the graph
+class AsyncTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 1; i <= 6; ++i) {
+            graph.add_vertex(i);
+        }
+        graph.add_edge(1, 2);
+        graph.add_edge(1, 3);
+        graph.add_edge(2, 4);
+        graph.add_edge(3, 4);
+        graph.add_edge(4, 5);
+    }
+
+    void TearDown() override {
+
+    }
+
+    grphx::directed_graph<int> graph;
+};
+
+TEST_F(AsyncTest, BfsMatchesSynchronousTraversal) {
+    auto result = grphx::bfs_async(graph, 1).get();
+
+    ASSERT_TRUE(result.completed());
+    ASSERT_EQ(result.vertices, graph.bfs(1));
+}
+
+TEST_F(AsyncTest, ShortestPathMatchesSynchronousSearch) {
+    auto path = grphx::shortest_path_async(graph, 1, 5).get();
+    auto none = grphx::shortest_path_async(graph, 5, 1, {}, grphx::inline_executor()).get();
+
+    ASSERT_TRUE(path.completed());
+    ASSERT_EQ(path.vertices, graph.shortest_path(1, 5));
+    ASSERT_TRUE(none.completed());
+    ASSERT_TRUE(none.vertices.empty());
+}
+
+TEST_F(AsyncTest, CancelledTraversalKeepsPartialResult) {
+    grphx::traversal_options options;
+    options.token.cancel();
+
+    auto partial = grphx::bfs_async(graph, 1, options, grphx::inline_executor()).get();
+    ASSERT_EQ(partial.status, grphx::traversal_status::cancelled);
+    ASSERT_EQ(partial.vertices, std::vector<int>({ 1 }));
+
+    options.partial_results = false;
+    auto empty = grphx::bfs_async(graph, 1, options, grphx::inline_executor()).get();
+    ASSERT_TRUE(empty.vertices.empty());
+
+    auto path = grphx::shortest_path_async(graph, 1, 5, options, grphx::inline_executor()).get();
+    ASSERT_EQ(path.status, grphx::traversal_status::cancelled);
+    ASSERT_TRUE(path.vertices.empty());
+}
+
+TEST_F(AsyncTest, DeadlineStopsTraversal) {
+    grphx::traversal_options options;
+    options.deadline = std::chrono::steady_clock::now();
+
+    auto result = grphx::bfs_async(graph, 1, options).get();
+    ASSERT_EQ(result.status, grphx::traversal_status::deadline_exceeded);
+}
+
+TEST_F(AsyncTest, RunsOnCustomExecutor) {
+    std::vector<std::function<void()>> queue;
+    auto executor = [&queue](std::function<void()> task) { queue.push_back(std::move(task)); };
+
+    auto future = grphx::bfs_async(graph, 2, {}, executor);
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+    queue.front()();
+    ASSERT_EQ(future.get().vertices, std::vector<int>({ 2, 4, 5 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
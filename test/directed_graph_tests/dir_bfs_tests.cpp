@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class BfsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(BfsTest, VisitsReachableVerticesLevelByLevel) {
+    grphx::directed_graph<int> graph;
+    for (int i = 1; i <= 5; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(2, 4);
+    graph.add_edge(5, 1);
+
+    ASSERT_EQ(graph.bfs(1), std::vector<int>({ 1, 2, 3, 4 }));
+    ASSERT_EQ(graph.dfs(1), std::vector<int>({ 1, 3, 2, 4 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
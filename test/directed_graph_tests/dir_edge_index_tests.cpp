@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class EdgeIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(EdgeIndexTest, IndexedGraph_TracksAddAndRemove) {
+    grphx::directed_graph<int> graph(grphx::edge_policy::simple, true);
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_vertex(3);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+
+    ASSERT_TRUE(graph.has_edge_index());
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+    ASSERT_EQ(graph.out_degree(1), 1);
+
+    graph.remove_edge(1, 2);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+
+    graph.remove_vertex(3);
+    ASSERT_FALSE(graph.contains_edge(2, 3));
+    graph.add_vertex(3);
+    ASSERT_FALSE(graph.contains_edge(2, 3));
+}
+
+TEST_F(EdgeIndexTest, EnablingIndexLater_IndexesExistingEdges) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+    // Integral vertices also have a slot table, which is not part of the edge index
+    const size_t vertex_index = graph.memory_usage().indexes;
+
+    graph.set_edge_index(true);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_GT(graph.memory_usage().indexes, vertex_index);
+
+    graph.set_edge_index(false);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_EQ(graph.memory_usage().indexes, vertex_index);
+}
+
+TEST_F(EdgeIndexTest, MultigraphPolicy_KeepsParallelEdges) {
+    grphx::directed_graph<int> graph(grphx::edge_policy::multigraph, true);
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 2);
+
+    ASSERT_EQ(graph.policy(), grphx::edge_policy::multigraph);
+    ASSERT_EQ(graph.out_degree(1), 2);
+
+    graph.remove_edge(1, 2);
+    ASSERT_EQ(graph.out_degree(1), 0);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+}
+
+TEST_F(EdgeIndexTest, HubVertex_ContainsEdge) {
+    grphx::directed_graph<int> graph(grphx::edge_policy::simple, true);
+    graph.add_vertex(0);
+    for (int i = 1; i <= 10000; ++i) {
+        graph.add_vertex(i);
+        graph.add_edge(0, i);
+    }
+
+    ASSERT_EQ(graph.out_degree(0), 10000);
+    ASSERT_TRUE(graph.contains_edge(0, 10000));
+    ASSERT_FALSE(graph.contains_edge(10000, 0));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
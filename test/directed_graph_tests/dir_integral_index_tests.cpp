@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class IntegralIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(IntegralIndexTest, MixesSlottedAndOutOfRangeVertices) {
+    grphx::directed_graph<long> graph;
+    graph.add_vertex(3);
+    graph.add_vertex(-7);
+    graph.add_vertex(1000000000L);
+    graph.add_edge(3, -7);
+    graph.add_edge(-7, 1000000000L);
+
+    ASSERT_TRUE(graph.contains_vertex(-7));
+    ASSERT_TRUE(graph.contains_vertex(1000000000L));
+    ASSERT_FALSE(graph.contains_vertex(4));
+    ASSERT_FALSE(graph.contains_vertex(-8));
+    ASSERT_EQ(graph.bfs(3), std::vector<long>({ 3, -7, 1000000000L }));
+    ASSERT_LT(graph.memory_usage().indexes, 1000000);
+}
+
+TEST_F(IntegralIndexTest, TableGrowsOverLargerIds) {
+    grphx::directed_graph<unsigned> graph;
+    graph.add_vertex(5000);
+    for (unsigned v = 0; v < 2000; ++v) {
+        graph.add_vertex(v);
+        graph.add_edge(v, 5000);
+    }
+
+    ASSERT_EQ(graph.size(), 2001);
+    ASSERT_EQ(graph.in_degree(5000), 2000);
+    ASSERT_TRUE(graph.contains_edge(1999, 5000));
+    ASSERT_FALSE(graph.contains_vertex(4999));
+}
+
+TEST_F(IntegralIndexTest, RemovalReorderAndClearKeepLookups) {
+    grphx::directed_graph<int> graph;
+    for (int v = 0; v < 10; ++v) {
+        graph.add_vertex(v);
+    }
+    for (int v = 0; v < 9; ++v) {
+        graph.add_edge(v, v + 1);
+    }
+
+    graph.remove_vertex(4);
+    ASSERT_FALSE(graph.contains_vertex(4));
+    graph.add_vertex(4);
+    graph.add_edge(3, 4);
+    ASSERT_EQ(graph.successors(3), std::list<int>({ 4 }));
+
+    graph.reorder(grphx::vertex_ordering::bfs);
+    ASSERT_EQ(graph.successors(7), std::list<int>({ 8 }));
+    graph.shrink_to_fit();
+    ASSERT_TRUE(graph.contains_edge(0, 1));
+
+    graph.clear();
+    ASSERT_FALSE(graph.contains_vertex(0));
+    graph.add_vertex(0);
+    ASSERT_TRUE(graph.contains_vertex(0));
+}
+
+TEST_F(IntegralIndexTest, UndirectedAndNonIntegralGraphs) {
+    grphx::undirected_graph<std::int16_t> numbers;
+    numbers.add_edge(-1, 2);
+    numbers.add_edge(2, 3);
+    ASSERT_EQ(numbers.degree(2), 2);
+    numbers.remove_vertex(-1);
+    ASSERT_EQ(numbers.neighbors(2), std::list<std::int16_t>({ 3 }));
+
+    grphx::undirected_graph<std::string> names;
+    names.add_edge("a", "b");
+    ASSERT_TRUE(names.contains_edge("b", "a"));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "grphx/grphx.hpp"
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class LazyRemovalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+
+    // Applies the same random churn to both graphs, re-adding removed vertices and edges now and then
+    static void churn(grphx::directed_graph<int>& lazy, grphx::directed_graph<int>& eager, unsigned seed) {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> vertex(0, 59);
+        std::uniform_int_distribution<int> operation(0, 9);
+        for (int step = 0; step < 3000; ++step) {
+            const int u = vertex(random);
+            const int v = vertex(random);
+            switch (operation(random)) {
+            case 0:
+                lazy.remove_vertex(u);
+                eager.remove_vertex(u);
+                break;
+            case 1:
+            case 2:
+                lazy.remove_edge(u, v);
+                eager.remove_edge(u, v);
+                break;
+            case 3:
+                lazy.add_vertex(u);
+                eager.add_vertex(u);
+                break;
+            default:
+                lazy.add_vertex(u);
+                eager.add_vertex(u);
+                lazy.add_edge(u, v);
+                eager.add_edge(u, v);
+                break;
+            }
+        }
+    }
+
+    static void expect_same(const grphx::directed_graph<int>& lazy, const grphx::directed_graph<int>& eager) {
+        ASSERT_EQ(lazy.size(), eager.size());
+        ASSERT_EQ(lazy.generation(), eager.generation());
+        for (int u = 0; u < 60; ++u) {
+            ASSERT_EQ(lazy.contains_vertex(u), eager.contains_vertex(u));
+            ASSERT_EQ(lazy.successors(u), eager.successors(u));
+            ASSERT_EQ(lazy.predecessors(u), eager.predecessors(u));
+            ASSERT_EQ(lazy.out_degree(u), eager.out_degree(u));
+            ASSERT_EQ(lazy.in_degree(u), eager.in_degree(u));
+            ASSERT_EQ(lazy.bfs(u), eager.bfs(u));
+            for (int v = 0; v < 60; ++v) {
+                ASSERT_EQ(lazy.contains_edge(u, v), eager.contains_edge(u, v));
+            }
+        }
+        ASSERT_EQ(grphx::csr_graph<int>(lazy).edge_count(), grphx::csr_graph<int>(eager).edge_count());
+    }
+};
+
+TEST_F(LazyRemovalTest, Churn_MatchesEagerRemoval) {
+    grphx::directed_graph<int> lazy;
+    grphx::directed_graph<int> eager;
+    lazy.set_lazy_removal(true);
+    lazy.set_tombstone_threshold(0.0);
+    ASSERT_TRUE(lazy.has_lazy_removal());
+
+    churn(lazy, eager, 7);
+    expect_same(lazy, eager);
+
+    lazy.compact();
+    ASSERT_EQ(lazy.tombstone_ratio(), 0.0);
+    expect_same(lazy, eager);
+}
+
+TEST_F(LazyRemovalTest, ChurnWithEdgeIndexAndCompaction_MatchesEagerRemoval) {
+    grphx::directed_graph<int> lazy(grphx::edge_policy::simple, true);
+    grphx::directed_graph<int> eager(grphx::edge_policy::simple, true);
+    lazy.set_lazy_removal(true);
+    lazy.set_tombstone_threshold(0.05);
+
+    churn(lazy, eager, 11);
+    expect_same(lazy, eager);
+}
+
+TEST_F(LazyRemovalTest, RemovalsAreTombstonedUntilThreshold) {
+    grphx::directed_graph<int> graph;
+    graph.set_lazy_removal(true);
+    for (int v = 0; v < 100; ++v) {
+        graph.add_vertex(v);
+    }
+    for (int v = 1; v < 100; ++v) {
+        graph.add_edge(0, v);
+        graph.add_edge(v, 0);
+    }
+
+    graph.remove_vertex(0);
+    graph.remove_edge(1, 0);
+    ASSERT_GT(graph.tombstone_ratio(), 0.0);
+    ASSERT_EQ(graph.in_degree(0), 0);
+    ASSERT_EQ(graph.out_degree(5), 0);
+    ASSERT_TRUE(graph.predecessors(0).empty());
+
+    // The next removal finds the tombstones beyond the threshold and compacts
+    graph.set_tombstone_threshold(0.01);
+    graph.remove_vertex(99);
+    ASSERT_EQ(graph.tombstone_ratio(), 0.0);
+    ASSERT_EQ(graph.size(), 98);
+    ASSERT_EQ(graph.in_degree(0), 0);
+}
+
+TEST_F(LazyRemovalTest, ReaddedVertexDoesNotReviveItsEdges) {
+    grphx::directed_graph<int> graph;
+    graph.set_lazy_removal(true);
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 1);
+
+    graph.remove_vertex(2);
+    graph.add_vertex(2);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+
+    graph.remove_edge(1, 1);
+    graph.add_edge(1, 2);
+    graph.remove_edge(1, 2);
+    graph.add_edge(1, 2);
+    ASSERT_EQ(graph.successors(1), std::list<int>({ 2 }));
+    ASSERT_EQ(graph.out_degree(1), 1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class MemoryUsageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(MemoryUsageTest, BreakdownGrowsWithVerticesAndEdges) {
+    grphx::directed_graph<int> graph;
+    const auto empty = graph.memory_usage();
+    ASSERT_EQ(empty.vertex_table, 0);
+    ASSERT_EQ(empty.adjacency, 0);
+
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+    const auto usage = graph.memory_usage();
+
+    ASSERT_EQ(usage.vertex_table, 2 * sizeof(int));
+    ASSERT_EQ(usage.adjacency, sizeof(int));
+    ASSERT_GT(usage.overhead, usage.vertex_table + usage.adjacency);
+    ASSERT_EQ(usage.total(), usage.vertex_table + usage.adjacency + usage.indexes + usage.overhead);
+}
+
+TEST_F(MemoryUsageTest, ShrinkToFit_KeepsGraphAfterBulkDeletes) {
+    grphx::directed_graph<int> graph(grphx::edge_policy::simple, true);
+    for (int i = 0; i < 1000; ++i) {
+        graph.add_vertex(i);
+    }
+    for (int i = 0; i < 999; ++i) {
+        graph.add_edge(i, i + 1);
+    }
+    for (int i = 0; i < 100; i += 2) {
+        graph.remove_vertex(i);
+    }
+    for (int i = 100; i < 1000; ++i) {
+        graph.remove_vertex(i);
+    }
+
+    // The slot table and the edge index buckets are sized for the deleted vertices until repacked
+    const auto before = graph.memory_usage();
+    graph.shrink_to_fit();
+    const auto after = graph.memory_usage();
+
+    ASSERT_LT(after.indexes, before.indexes);
+    ASSERT_LT(after.total(), before.total());
+    ASSERT_EQ(graph.size(), 50);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    graph.add_edge(1, 3);
+    ASSERT_TRUE(graph.contains_edge(1, 3));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "grphx/query_cache.hpp"
+
+// Define a test fixture for the graph
+class QueryCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 1; i <= 5; ++i) {
+            graph.add_vertex(i);
+        }
+        graph.add_edge(1, 2);
+        graph.add_edge(1, 3);
+        graph.add_edge(2, 4);
+        graph.add_edge(5, 1);
+    }
+
+    void TearDown() override {
+
+    }
+
+    grphx::directed_graph<int> graph;
+};
+
+TEST_F(QueryCacheTest, RepeatedQueriesHit) {
+    grphx::query_cache<int> cache(graph);
+
+    ASSERT_EQ(cache.bfs(1), graph.bfs(1));
+    ASSERT_EQ(cache.bfs(1), std::vector<int>({ 1, 2, 3, 4 }));
+    ASSERT_EQ(cache.dfs(1), graph.dfs(1));
+    ASSERT_TRUE(cache.is_reachable(5, 4));
+    ASSERT_TRUE(cache.is_reachable(5, 3));
+    ASSERT_FALSE(cache.is_reachable(1, 5));
+
+    ASSERT_EQ(cache.stats().hits, 2);
+    ASSERT_EQ(cache.stats().misses, 4);
+    ASSERT_EQ(cache.size(), 4);
+}
+
+TEST_F(QueryCacheTest, MutationsInvalidate) {
+    grphx::query_cache<int> cache(graph);
+    ASSERT_FALSE(cache.is_reachable(4, 5));
+
+    const std::uint64_t generation = graph.generation();
+    graph.add_edge(4, 5);
+    ASSERT_NE(graph.generation(), generation);
+    ASSERT_TRUE(cache.is_reachable(4, 5));
+    ASSERT_EQ(cache.stats().invalidations, 1);
+
+    graph.remove_edge(2, 4);
+    ASSERT_FALSE(cache.is_reachable(1, 4));
+
+    graph.remove_vertex(3);
+    ASSERT_EQ(cache.bfs(1), std::vector<int>({ 1, 2 }));
+
+    graph.add_vertex(6);
+    ASSERT_EQ(cache.bfs(6), std::vector<int>({ 6 }));
+    ASSERT_EQ(cache.stats().hits, 0);
+    ASSERT_EQ(cache.stats().invalidations, 4);
+}
+
+TEST_F(QueryCacheTest, NoOpMutationsKeepResults) {
+    grphx::query_cache<int> cache(graph);
+    cache.bfs(1);
+
+    graph.add_vertex(1);
+    graph.add_edge(1, 2);
+    graph.add_edge(42, 1);
+    graph.remove_vertex(42);
+    graph.remove_edge(1, 5);
+    graph.remove_edge(42, 1);
+    cache.bfs(1);
+
+    ASSERT_EQ(cache.stats().hits, 1);
+    ASSERT_EQ(cache.stats().invalidations, 0);
+}
+
+TEST_F(QueryCacheTest, EvictsLeastRecentlyUsed) {
+    grphx::query_cache<int> cache(graph, 2);
+    cache.bfs(1);
+    cache.bfs(2);
+    cache.bfs(1);
+    cache.bfs(3);
+
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.stats().evictions, 1);
+
+    cache.bfs(1);
+    ASSERT_EQ(cache.stats().hits, 2);
+    cache.bfs(2);
+    ASSERT_EQ(cache.stats().misses, 4);
+
+    cache.set_capacity(1);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(QueryCacheTest, ZeroCapacityDisablesCaching) {
+    grphx::query_cache<int> cache(graph, 0);
+
+    ASSERT_EQ(cache.bfs(1), std::vector<int>({ 1, 2, 3, 4 }));
+    ASSERT_EQ(cache.bfs(1), std::vector<int>({ 1, 2, 3, 4 }));
+    ASSERT_EQ(cache.stats().hits, 0);
+    ASSERT_EQ(cache.stats().evictions, 0);
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_DOUBLE_EQ(cache.stats().hit_ratio(), 0.0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
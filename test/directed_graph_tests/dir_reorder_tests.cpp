@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class ReorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(ReorderTest, DegreeOrdering_PreservesEdges) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_vertex(3);
+    graph.add_edge(1, 2);
+    graph.add_edge(3, 1);
+    graph.add_edge(3, 2);
+
+    graph.reorder(grphx::vertex_ordering::degree);
+
+    ASSERT_EQ(graph.size(), 3);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+    ASSERT_TRUE(graph.contains_edge(3, 1));
+    ASSERT_TRUE(graph.contains_edge(3, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+    ASSERT_EQ(graph.out_degree(3), 2);
+}
+
+TEST_F(ReorderTest, DegreeOrdering_SortsNeighborsByNewOrder) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_vertex(3);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(3, 1);
+    graph.add_edge(3, 2);
+    graph.add_edge(2, 3);
+
+    graph.reorder(grphx::vertex_ordering::degree);
+
+    // Vertices 1 and 3 have two successors and come before vertex 2
+    ASSERT_EQ(graph.successors(2), std::list<int>({ 3 }));
+    ASSERT_EQ(graph.successors(1), std::list<int>({ 3, 2 }));
+}
+
+TEST_F(ReorderTest, ReverseCuthillMcKee_KeepsPredecessors) {
+    grphx::directed_graph<int> graph;
+    for (int i = 1; i <= 5; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(1, 5);
+    graph.add_edge(5, 2);
+    graph.add_edge(2, 4);
+    graph.add_edge(4, 3);
+
+    graph.reorder(grphx::vertex_ordering::reverse_cuthill_mckee);
+
+    ASSERT_EQ(graph.size(), 5);
+    ASSERT_EQ(graph.predecessors(4), std::list<int>({ 2 }));
+    ASSERT_EQ(graph.in_degree(3), 1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <unordered_map>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class ShortestPathTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(ShortestPathTest, FollowsEdgeDirections) {
+    grphx::directed_graph<int> graph;
+    for (int i = 1; i <= 6; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 4);
+    graph.add_edge(1, 5);
+    graph.add_edge(5, 4);
+    graph.add_edge(4, 6);
+    graph.add_edge(6, 1);
+
+    ASSERT_EQ(graph.shortest_path(1, 6), std::vector<int>({ 1, 5, 4, 6 }));
+    ASSERT_EQ(graph.shortest_path(6, 3), std::vector<int>({ 6, 1, 2, 3 }));
+    ASSERT_EQ(graph.shortest_path(2, 2), std::vector<int>({ 2 }));
+}
+
+TEST_F(ShortestPathTest, UnreachableOrMissingTarget_ReturnsEmptyPath) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+
+    ASSERT_TRUE(graph.shortest_path(2, 1).empty());
+    ASSERT_TRUE(graph.shortest_path(1, 3).empty());
+}
+
+TEST_F(ShortestPathTest, LongChain_FindsEveryHop) {
+    grphx::directed_graph<int> graph;
+    for (int i = 0; i < 50; ++i) {
+        graph.add_vertex(i);
+    }
+    for (int i = 0; i < 49; ++i) {
+        graph.add_edge(i, i + 1);
+    }
+    graph.add_edge(10, 40);
+
+    const auto path = graph.shortest_path(0, 49);
+
+    ASSERT_EQ(path.size(), 21);
+    ASSERT_EQ(path.front(), 0);
+    ASSERT_EQ(path.back(), 49);
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        ASSERT_TRUE(graph.contains_edge(path[i], path[i + 1]));
+    }
+}
+
+TEST_F(ShortestPathTest, HubFrontiers_MatchBfsDistances) {
+    // Sources fan out to a hub while targets have few predecessors, so both directions get expanded
+    grphx::directed_graph<int> graph;
+    for (int i = 0; i < 400; ++i) {
+        graph.add_vertex(i);
+    }
+    for (int i = 0; i < 400; ++i) {
+        graph.add_edge(i, (i * 37 + 11) % 400);
+        graph.add_edge(i, (i * i + 3) % 400);
+        graph.add_edge(0, i);
+    }
+
+    for (int source = 1; source < 400; source += 37) {
+        std::unordered_map<int, size_t> distance{ { source, 0 } };
+        const std::vector<int> order = graph.bfs(source);
+        for (int v : order) {
+            for (int w : graph.successors(v)) {
+                distance.emplace(w, distance.at(v) + 1);
+            }
+        }
+
+        for (int target = 0; target < 400; target += 13) {
+            const auto path = graph.shortest_path(source, target);
+            auto it = distance.find(target);
+            if (it == distance.end()) {
+                ASSERT_TRUE(path.empty());
+                continue;
+            }
+            ASSERT_EQ(path.size(), it->second + 1);
+            ASSERT_EQ(path.front(), source);
+            ASSERT_EQ(path.back(), target);
+            for (size_t i = 0; i + 1 < path.size(); ++i) {
+                ASSERT_TRUE(graph.contains_edge(path[i], path[i + 1]));
+            }
+        }
+    }
+}
+
+TEST_F(ShortestPathTest, DanglingEdgeTarget_IsSkipped) {
+    // Directed edges only need their source to be a vertex
+    grphx::directed_graph<int> graph;
+    for (int i = 1; i <= 3; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(1, 99);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 98);
+
+    ASSERT_EQ(graph.shortest_path(1, 3), std::vector<int>({ 1, 2, 3 }));
+    ASSERT_TRUE(graph.shortest_path(3, 1).empty());
+    ASSERT_TRUE(graph.shortest_path(1, 99).empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include "grphx/generators.hpp"
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class GeneratorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(GeneratorTest, RmatIsSkewedAndIndependentOfThreads) {
+    const grphx::edge_list one = grphx::rmat_graph(10, 8, 0.57, 0.19, 0.19, 1, 42);
+    const grphx::edge_list many = grphx::rmat_graph(10, 8, 0.57, 0.19, 0.19, 4, 42);
+
+    ASSERT_EQ(one.vertices, 1024);
+    ASSERT_EQ(one.edges.size(), 8192);
+    ASSERT_EQ(one.edges, many.edges);
+    ASSERT_NE(one.edges, grphx::rmat_graph(10, 8, 0.57, 0.19, 0.19, 1, 43).edges);
+
+    // Vertex 0 collects the top-left quadrant at every level
+    std::vector<size_t> degree(one.vertices, 0);
+    for (const auto& edge : one.edges) {
+        ASSERT_LT(edge.first, one.vertices);
+        ASSERT_LT(edge.second, one.vertices);
+        ++degree[edge.first];
+    }
+    ASSERT_EQ(*std::max_element(degree.begin(), degree.end()), degree[0]);
+    ASSERT_GT(degree[0], 8 * 8);
+}
+
+TEST_F(GeneratorTest, KroneckerPermutesVertices) {
+    const grphx::edge_list rmat = grphx::rmat_graph(8, 16, 0.57, 0.19, 0.19, 2, 7);
+    const grphx::edge_list kronecker = grphx::kronecker_graph(8, 16, 3, 7);
+
+    ASSERT_EQ(kronecker.edges.size(), rmat.edges.size());
+    std::vector<size_t> rmat_degree(256, 0);
+    std::vector<size_t> kronecker_degree(256, 0);
+    for (size_t i = 0; i < rmat.edges.size(); ++i) {
+        ++rmat_degree[rmat.edges[i].first];
+        ++kronecker_degree[kronecker.edges[i].first];
+    }
+    ASSERT_NE(rmat_degree, kronecker_degree);
+    std::sort(rmat_degree.begin(), rmat_degree.end());
+    std::sort(kronecker_degree.begin(), kronecker_degree.end());
+    ASSERT_EQ(rmat_degree, kronecker_degree);
+}
+
+TEST_F(GeneratorTest, ErdosRenyiHasExpectedDensity) {
+    const grphx::edge_list undirected = grphx::erdos_renyi_graph(2000, 0.01, false, 4, 1);
+    const std::set<std::pair<size_t, size_t>> unique(undirected.edges.begin(), undirected.edges.end());
+
+    ASSERT_EQ(unique.size(), undirected.edges.size());
+    for (const auto& edge : undirected.edges) {
+        ASSERT_LT(edge.first, edge.second);
+        ASSERT_LT(edge.second, 2000);
+    }
+    // About 2000 * 1999 / 2 * 0.01 = 19990 edges, with a standard deviation of about 140
+    ASSERT_NEAR(static_cast<double>(undirected.edges.size()), 19990.0, 1000.0);
+    ASSERT_EQ(undirected.edges, grphx::erdos_renyi_graph(2000, 0.01, false, 1, 1).edges);
+
+    const grphx::edge_list complete = grphx::erdos_renyi_graph(5, 1.0, true);
+    ASSERT_EQ(complete.edges.size(), 20);
+    ASSERT_TRUE(grphx::erdos_renyi_graph(5, 0.0).edges.empty());
+}
+
+TEST_F(GeneratorTest, BarabasiAlbertAttachesToEarlierVertices) {
+    const grphx::edge_list list = grphx::barabasi_albert_graph(5000, 3, 4, 9);
+
+    ASSERT_EQ(list.edges.size(), 4999 * 3);
+    ASSERT_EQ(list.edges, grphx::barabasi_albert_graph(5000, 3, 1, 9).edges);
+    std::vector<size_t> degree(list.vertices, 0);
+    for (const auto& edge : list.edges) {
+        ASSERT_LT(edge.second, edge.first);
+        ++degree[edge.first];
+        ++degree[edge.second];
+    }
+
+    // Preferential attachment gives the early vertices hubs far above the average degree of 6
+    ASSERT_GT(*std::max_element(degree.begin(), degree.begin() + 10), 60);
+}
+
+TEST_F(GeneratorTest, GridsHaveLatticeDegrees) {
+    grphx::undirected_graph<int> plane;
+    grphx::add_edge_list(plane, grphx::grid_graph(4, 3));
+    ASSERT_EQ(plane.size(), 12);
+    ASSERT_EQ(plane.degree(0), 2);
+    ASSERT_EQ(plane.degree(1), 3);
+    ASSERT_EQ(plane.degree(5), 4);
+    ASSERT_TRUE(plane.contains_edge(5, 9));
+
+    const grphx::edge_list cube = grphx::grid_graph(3, 3, 3, false, 2);
+    ASSERT_EQ(cube.vertices, 27);
+    ASSERT_EQ(cube.edges.size(), 3 * 3 * 2 * 3);
+
+    grphx::undirected_graph<int> torus;
+    grphx::add_edge_list(torus, grphx::grid_graph(5, 4, 3, true, 3));
+    for (int v = 0; v < 60; ++v) {
+        ASSERT_EQ(torus.degree(v), 6);
+    }
+}
+
+TEST_F(GeneratorTest, AddEdgeListBuildsDirectedGraph) {
+    const grphx::edge_list list = grphx::erdos_renyi_graph(300, 0.05, true, 2, 5);
+    grphx::directed_graph<int> graph;
+    grphx::add_edge_list(graph, list);
+
+    ASSERT_EQ(graph.size(), 300);
+    const grphx::csr_graph<int> csr(graph);
+    ASSERT_EQ(csr.edge_count(), list.edges.size());
+    for (const auto& edge : list.edges) {
+        ASSERT_TRUE(graph.contains_edge(static_cast<int>(edge.first), static_cast<int>(edge.second)));
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
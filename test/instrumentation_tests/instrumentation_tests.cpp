@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class InstrumentationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(InstrumentationTest, CountsCallsPerOperation) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_edge(1, 2);
+    graph.predecessors(2);
+    graph.predecessors(1);
+
+    const auto& stats = graph.stats();
+    ASSERT_EQ(stats[grphx::graph_operation::add_vertex].calls, 2);
+    ASSERT_EQ(stats[grphx::graph_operation::add_edge].calls, 1);
+    ASSERT_EQ(stats[grphx::graph_operation::predecessors].calls, 2);
+    ASSERT_EQ(stats[grphx::graph_operation::remove_edge].calls, 0);
+}
+
+TEST_F(InstrumentationTest, RecordsEdgesTouchedByBfs) {
+    grphx::directed_graph<int> graph;
+    graph.add_vertex(1);
+    graph.add_vertex(2);
+    graph.add_vertex(3);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(2, 3);
+    graph.reset_stats();
+
+    ASSERT_EQ(graph.bfs(1), std::vector<int>({ 1, 2, 3 }));
+
+    const grphx::graph_stats stats = graph.stats();
+    const auto& bfs = stats[grphx::graph_operation::bfs];
+    ASSERT_EQ(bfs.calls, 1);
+    ASSERT_EQ(bfs.vertices_touched, 3);
+    ASSERT_EQ(bfs.edges_touched, 3);
+    ASSERT_EQ(stats[grphx::graph_operation::successors].calls, 3);
+
+    size_t histogram_total{ 0 };
+    for (size_t count : bfs.latency_histogram) {
+        histogram_total += count;
+    }
+    ASSERT_EQ(histogram_total, 1);
+}
+
+TEST_F(InstrumentationTest, HookReceivesEverySample) {
+    grphx::undirected_graph<int> graph;
+    std::vector<grphx::graph_operation> operations;
+    graph.set_instrumentation_hook([&operations](const grphx::operation_sample& sample) {
+        operations.push_back(sample.operation);
+    });
+
+    graph.add_vertex(1);
+    graph.neighbors(1);
+
+    ASSERT_EQ(operations.size(), 3);
+    ASSERT_EQ(operations[0], grphx::graph_operation::contains_vertex);
+    ASSERT_EQ(operations[1], grphx::graph_operation::add_vertex);
+    ASSERT_EQ(operations[2], grphx::graph_operation::neighbors);
+    ASSERT_STREQ(grphx::to_string(operations[2]), "neighbors");
+}
+
+TEST_F(InstrumentationTest, ConcurrentReadersAreAllCounted) {
+    grphx::directed_graph<int> graph;
+    for (int i = 0; i < 50; ++i) {
+        graph.add_vertex(i);
+    }
+    for (int i = 0; i + 1 < 50; ++i) {
+        graph.add_edge(i, i + 1);
+    }
+    size_t hook_calls{ 0 };
+    graph.set_instrumentation_hook([&hook_calls](const grphx::operation_sample&) { ++hook_calls; });
+    graph.reset_stats();
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&graph]() {
+            for (int i = 0; i < 20; ++i) {
+                graph.bfs(0);
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    const grphx::graph_stats stats = graph.stats();
+    ASSERT_EQ(stats[grphx::graph_operation::bfs].calls, 80);
+    ASSERT_EQ(stats[grphx::graph_operation::successors].calls, 80 * 50);
+    ASSERT_EQ(hook_calls, 80 + 80 * 50);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "grphx/distributed.hpp"
+
+// Define a test fixture for the graph
+class DistributedBfsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(DistributedBfsTest, DistancesMatchSequentialBfs) {
+    grphx::directed_graph<int> graph;
+    for (int i = 0; i < 6; ++i) {
+        graph.add_vertex(i);
+    }
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 2);
+    graph.add_edge(1, 3);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 4);
+    graph.add_edge(5, 0);
+
+    grphx::csr_graph<int> csr(graph);
+    for (auto strategy : { grphx::partition_strategy::hash, grphx::partition_strategy::edge_cut, grphx::partition_strategy::vertex_cut }) {
+        grphx::partitioned_graph<int> partitioned(csr, 3, strategy);
+
+        const auto distances = grphx::distributed_bfs(partitioned, 0);
+
+        ASSERT_EQ(distances.size(), 5);
+        ASSERT_EQ(distances.at(0), 0);
+        ASSERT_EQ(distances.at(1), 1);
+        ASSERT_EQ(distances.at(2), 1);
+        ASSERT_EQ(distances.at(3), 2);
+        ASSERT_EQ(distances.at(4), 3);
+        ASSERT_EQ(distances.count(5), 0);
+    }
+}
+
+TEST_F(DistributedBfsTest, UnknownStart_ReturnsNothing) {
+    grphx::csr_graph<int> csr({ 1, 2 }, { { 1, 2 } });
+    grphx::partitioned_graph<int> partitioned(csr, 2, grphx::partition_strategy::hash);
+
+    ASSERT_TRUE(grphx::distributed_bfs(partitioned, 42).empty());
+}
+
+TEST_F(DistributedBfsTest, ConnectedComponents_LabelsEveryComponent) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(4, 5);
+    graph.add_vertex(6);
+
+    grphx::csr_graph<int> csr(graph);
+    grphx::partitioned_graph<int> partitioned(csr, 2, grphx::partition_strategy::edge_cut);
+
+    const auto components = grphx::distributed_connected_components(partitioned);
+
+    ASSERT_EQ(components.size(), 6);
+    ASSERT_EQ(components.at(1), 1);
+    ASSERT_EQ(components.at(2), 1);
+    ASSERT_EQ(components.at(3), 1);
+    ASSERT_EQ(components.at(4), 4);
+    ASSERT_EQ(components.at(5), 4);
+    ASSERT_EQ(components.at(6), 6);
+}
+
+#if defined(__linux__)
+TEST_F(DistributedBfsTest, RefusesToForkWhileOtherThreadsRun) {
+    grphx::csr_graph<int> csr({ 1, 2 }, { { 1, 2 } });
+    grphx::partitioned_graph<int> partitioned(csr, 2, grphx::partition_strategy::hash);
+
+    std::atomic<bool> done{ false };
+    std::thread other([&done]() {
+        while (!done) {
+            std::this_thread::yield();
+        }
+    });
+    ASSERT_THROW(grphx::distributed_bfs(partitioned, 1), std::logic_error);
+    done = true;
+    other.join();
+
+    ASSERT_EQ(grphx::distributed_bfs(partitioned, 1).size(), 2);
+}
+#endif
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "grphx/partition.hpp"
+
+// Define a test fixture for the graph
+class PartitionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+
+    // Two dense clusters of 8 vertices connected by a single edge
+    static grphx::csr_graph<int> clustered_graph() {
+        std::vector<std::pair<int, int>> edges;
+        for (int c = 0; c < 2; ++c) {
+            for (int i = 0; i < 8; ++i) {
+                for (int j = i + 1; j < 8; ++j) {
+                    edges.emplace_back(c * 8 + i, c * 8 + j);
+                }
+            }
+        }
+        edges.emplace_back(7, 8);
+
+        return grphx::csr_graph<int>({}, edges, false);
+    }
+};
+
+TEST_F(PartitionTest, EveryStrategy_CoversAllVerticesAndEdges) {
+    const auto graph = clustered_graph();
+
+    for (auto strategy : { grphx::partition_strategy::hash, grphx::partition_strategy::edge_cut, grphx::partition_strategy::vertex_cut }) {
+        grphx::partitioned_graph<int> partitioned(graph, 3, strategy);
+
+        size_t masters{ 0 };
+        size_t edges{ 0 };
+        for (size_t p = 0; p < partitioned.partition_count(); ++p) {
+            const auto& part = partitioned.part(p);
+            masters += part.masters.size();
+            edges += part.targets.size();
+            for (size_t v : part.masters) {
+                ASSERT_EQ(partitioned.owner(v), p);
+            }
+            for (size_t v : part.ghosts) {
+                ASSERT_NE(partitioned.owner(v), p);
+            }
+        }
+
+        ASSERT_EQ(masters, graph.size());
+        ASSERT_EQ(edges, graph.edge_count());
+    }
+}
+
+TEST_F(PartitionTest, EdgeCut_CutsFewerEdgesThanHash) {
+    const auto graph = clustered_graph();
+
+    grphx::partitioned_graph<int> hashed(graph, 2, grphx::partition_strategy::hash);
+    grphx::partitioned_graph<int> greedy(graph, 2, grphx::partition_strategy::edge_cut);
+
+    ASSERT_LT(greedy.cut_edges(), hashed.cut_edges());
+    ASSERT_EQ(greedy.cut_edges(), 2);
+}
+
+TEST_F(PartitionTest, VertexCut_ReplicatesOnlyBoundaryVertices) {
+    const auto graph = clustered_graph();
+
+    grphx::partitioned_graph<int> partitioned(graph, 2, grphx::partition_strategy::vertex_cut);
+
+    ASSERT_GE(partitioned.replication_factor(), 1.0);
+    ASSERT_LT(partitioned.replication_factor(), 2.0);
+    for (size_t v = 0; v < graph.size(); ++v) {
+        ASSERT_FALSE(partitioned.holders(v).empty());
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
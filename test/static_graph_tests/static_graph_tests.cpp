@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "grphx/static_graph.hpp"
+
+namespace {
+
+    // A pipeline DAG built and analysed entirely at compile time
+    constexpr grphx::static_graph<6> pipeline{ { 0, 1 }, { 0, 2 }, { 1, 3 }, { 2, 3 }, { 3, 4 } };
+    constexpr auto pipeline_closure = pipeline.transitive_closure();
+    constexpr auto pipeline_order = pipeline.bfs(0);
+
+    static_assert(pipeline.contains_edge(0, 1), "edge 0 -> 1");
+    static_assert(!pipeline.contains_edge(1, 0), "edges are directed");
+    static_assert(pipeline.out_degree(0) == 2 && pipeline.in_degree(3) == 2, "degrees");
+    static_assert(pipeline_closure.contains_edge(0, 4), "4 is reachable from 0");
+    static_assert(!pipeline_closure.contains_edge(0, 5), "5 is isolated");
+    static_assert(pipeline_order.size == 5 && pipeline_order[4] == 4, "bfs order");
+
+} // end of anonymous namespace
+
+// Define a test fixture for the graph
+class StaticGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(StaticGraphTest, AddAndRemoveEdges) {
+    grphx::static_graph<4> graph;
+    graph.add_edge(0, 1);
+    graph.add_edge(0, 1);
+    graph.add_edge(1, 2);
+
+    ASSERT_EQ(graph.edge_count(), 2);
+    graph.remove_edge(0, 1);
+    ASSERT_FALSE(graph.contains_edge(0, 1));
+    ASSERT_EQ(graph.edge_count(), 1);
+}
+
+TEST_F(StaticGraphTest, BfsAcrossWordBoundaries) {
+    grphx::static_graph<200> graph;
+    for (size_t v = 0; v + 1 < 200; ++v) {
+        graph.add_edge(v, v + 1);
+    }
+    graph.add_edge(0, 130);
+
+    auto order = graph.bfs(0);
+
+    ASSERT_EQ(order.size, 200);
+    ASSERT_EQ(order[1], 1);
+    ASSERT_EQ(order[2], 130);
+    ASSERT_TRUE(graph.is_reachable(0, 199));
+    ASSERT_FALSE(graph.is_reachable(199, 0));
+}
+
+TEST_F(StaticGraphTest, TransitiveClosure_MatchesReachability) {
+    grphx::static_graph<70> graph{ { 0, 65 }, { 65, 3 }, { 3, 69 }, { 69, 0 }, { 10, 11 } };
+
+    auto closure = graph.transitive_closure();
+
+    for (size_t u = 0; u < 70; ++u) {
+        auto reachable = graph.reachable_from(u);
+        for (size_t v = 0; v < 70; ++v) {
+            const bool path = (reachable[v / 64] >> (v % 64)) & 1;
+            if (u != v) {
+                ASSERT_EQ(closure.contains_edge(u, v), path);
+            }
+        }
+    }
+    ASSERT_TRUE(closure.contains_edge(0, 0));
+    ASSERT_FALSE(closure.contains_edge(10, 10));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -48,6 +48,22 @@ TEST_F(AddEdgeTest, AddDuplicateEdgeTest) {
     ASSERT_TRUE(graph.contains_edge(2, 1)); // Undirected graph, so edge should exist in both directions
 }
 
+TEST_F(AddEdgeTest, AddEdgesInBulk_AddsMissingVertices) {
+    grphx::undirected_graph<int> graph(grphx::edge_policy::simple);
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 100; ++i) {
+        edges.emplace_back(i, (i + 1) % 100);
+        edges.emplace_back((i + 1) % 100, i); // Duplicate under the simple policy
+    }
+    graph.add_edges(edges);
+
+    ASSERT_EQ(graph.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(graph.degree(i), 2);
+        ASSERT_TRUE(graph.contains_edge((i + 1) % 100, i));
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "grphx/connectivity.hpp"
+
+// Define a test fixture for the graph
+class ConnectivityTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(ConnectivityTest, TracksInsertions) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_vertex(3);
+
+    grphx::connectivity_tracker<int> tracker(graph);
+    ASSERT_TRUE(tracker.connected(1, 2));
+    ASSERT_FALSE(tracker.connected(1, 3));
+    ASSERT_EQ(tracker.component_count(), 2);
+
+    graph.add_edge(2, 3);
+    graph.add_edge(4, 5);
+    ASSERT_TRUE(tracker.connected(1, 3));
+    ASSERT_FALSE(tracker.connected(3, 4));
+    ASSERT_FALSE(tracker.connected(1, 42));
+    ASSERT_EQ(tracker.component_count(), 2);
+}
+
+TEST_F(ConnectivityTest, RecomputesSplitComponents) {
+    grphx::undirected_graph<int> graph;
+    grphx::connectivity_tracker<int> tracker(graph);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 1);
+    graph.add_edge(3, 4);
+
+    graph.remove_edge(1, 2);
+    ASSERT_TRUE(tracker.connected(1, 2));
+
+    graph.remove_edge(3, 4);
+    ASSERT_FALSE(tracker.connected(1, 4));
+    ASSERT_EQ(tracker.component_count(), 2);
+
+    graph.remove_vertex(3);
+    ASSERT_FALSE(tracker.connected(1, 2));
+    ASSERT_FALSE(tracker.connected(3, 3));
+    ASSERT_EQ(tracker.component_count(), 3);
+
+    graph.add_edge(4, 1);
+    ASSERT_TRUE(tracker.connected(4, 1));
+    ASSERT_EQ(tracker.component_count(), 2);
+}
+
+TEST_F(ConnectivityTest, MatchesTraversalUnderMixedUpdates) {
+    grphx::undirected_graph<int> graph(grphx::edge_policy::simple);
+    grphx::connectivity_tracker<int> tracker(graph);
+    for (int i = 0; i < 3000; ++i) {
+        graph.add_edge((i * 37) % 500, (i * 91 + 7) % 500);
+        if (i % 5 == 0)
+            graph.remove_edge((i * 13) % 500, (i * 29 + 3) % 500);
+        if (i % 250 == 0)
+            graph.remove_vertex((i * 7) % 500);
+    }
+
+    for (int u = 0; u < 500; u += 37) {
+        const std::vector<int> order = graph.bfs(u);
+        for (int v = 0; v < 500; v += 11) {
+            const bool reached = std::find(order.begin(), order.end(), v) != order.end() && graph.contains_vertex(u);
+            ASSERT_EQ(tracker.connected(u, v), reached) << u << " - " << v;
+        }
+    }
+}
+
+TEST_F(ConnectivityTest, ClearAndDetach) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    {
+        grphx::connectivity_tracker<int> tracker(graph);
+        graph.clear();
+        ASSERT_FALSE(tracker.connected(1, 2));
+        ASSERT_EQ(tracker.component_count(), 0);
+    }
+
+    graph.add_edge(1, 2);
+    ASSERT_TRUE(graph.contains_edge(1, 2));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
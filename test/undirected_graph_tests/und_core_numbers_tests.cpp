@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "grphx/core_decomposition.hpp"
+
+// Define a test fixture for the graph
+class CoreNumbersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(CoreNumbersTest, CliqueWithTail_HasExpectedCores) {
+    grphx::undirected_graph<int> graph;
+    for (int u = 1; u <= 4; ++u) {
+        for (int v = u + 1; v <= 4; ++v) {
+            graph.add_edge(u, v);
+        }
+    }
+    graph.add_edge(4, 5);
+    graph.add_edge(5, 6);
+    graph.add_vertex(7);
+
+    auto core = grphx::core_numbers(graph);
+
+    ASSERT_EQ(core.at(1), 3);
+    ASSERT_EQ(core.at(4), 3);
+    ASSERT_EQ(core.at(5), 1);
+    ASSERT_EQ(core.at(6), 1);
+    ASSERT_EQ(core.at(7), 0);
+}
+
+TEST_F(CoreNumbersTest, KCore_ReturnsSubgraphWithoutMutating) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 1);
+    graph.add_edge(3, 4);
+
+    auto core = grphx::k_core(graph, 2);
+
+    ASSERT_EQ(core.size(), 3);
+    ASSERT_FALSE(core.contains_vertex(4));
+    ASSERT_TRUE(core.contains_edge(1, 3));
+    ASSERT_TRUE(graph.contains_vertex(4));
+    ASSERT_EQ(graph.degree(3), 3);
+}
+
+TEST_F(CoreNumbersTest, ParallelPeeling_MatchesBucketAlgorithm) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < 1000; ++i) {
+        edges.emplace_back(i, (i * 7 + 1) % 1000);
+        if (i % 3 == 0)
+            edges.emplace_back(i, (i * 13 + 5) % 1000);
+        if (i < 50) {
+            for (int j = i + 1; j < 50; j += 3) {
+                edges.emplace_back(i, j);
+            }
+        }
+    }
+    grphx::csr_graph<int> graph({}, edges, false);
+
+    auto expected = grphx::core_numbers(graph);
+
+    ASSERT_EQ(grphx::parallel_core_numbers(graph, 1), expected);
+    ASSERT_EQ(grphx::parallel_core_numbers(graph, 4), expected);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
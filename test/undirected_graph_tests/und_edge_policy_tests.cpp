@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class EdgePolicyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(EdgePolicyTest, DefaultPolicy_IsMultigraph) {
+    grphx::undirected_graph<int> graph;
+
+    ASSERT_EQ(graph.policy(), grphx::edge_policy::multigraph);
+    ASSERT_FALSE(graph.has_edge_index());
+}
+
+TEST_F(EdgePolicyTest, SimplePolicy_IgnoresDuplicatesInBothDirections) {
+    grphx::undirected_graph<int> graph(grphx::edge_policy::simple);
+    graph.add_edge(1, 2);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 1);
+
+    ASSERT_EQ(graph.degree(1), 1);
+    ASSERT_EQ(graph.degree(2), 1);
+}
+
+TEST_F(EdgePolicyTest, IndexedSimpleGraph_TracksAddAndRemove) {
+    grphx::undirected_graph<int> graph(grphx::edge_policy::simple, true);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+
+    ASSERT_TRUE(graph.contains_edge(2, 1));
+    ASSERT_TRUE(graph.contains_edge(3, 2));
+
+    graph.remove_edge(2, 1);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+
+    graph.remove_vertex(3);
+    ASSERT_FALSE(graph.contains_edge(2, 3));
+    graph.add_edge(2, 3);
+    ASSERT_TRUE(graph.contains_edge(3, 2));
+    ASSERT_EQ(graph.degree(2), 1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "grphx/grphx.hpp"
+#include "grphx/csr_graph.hpp"
+
+// Define a test fixture for the graph
+class LazyRemovalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+TEST_F(LazyRemovalTest, Churn_MatchesEagerRemoval) {
+    grphx::undirected_graph<int> lazy;
+    grphx::undirected_graph<int> eager;
+    lazy.set_lazy_removal(true);
+    lazy.set_tombstone_threshold(0.1);
+
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> vertex(0, 49);
+    std::uniform_int_distribution<int> operation(0, 9);
+    for (int step = 0; step < 3000; ++step) {
+        const int u = vertex(random);
+        const int v = vertex(random);
+        const int op = operation(random);
+        if (op == 0) {
+            lazy.remove_vertex(u);
+            eager.remove_vertex(u);
+        }
+        else if (op < 3) {
+            lazy.remove_edge(u, v);
+            eager.remove_edge(u, v);
+        }
+        else {
+            lazy.add_edge(u, v);
+            eager.add_edge(u, v);
+        }
+    }
+
+    ASSERT_EQ(lazy.size(), eager.size());
+    ASSERT_EQ(lazy.generation(), eager.generation());
+    for (int u = 0; u < 50; ++u) {
+        ASSERT_EQ(lazy.neighbors(u), eager.neighbors(u));
+        ASSERT_EQ(lazy.degree(u), eager.degree(u));
+        ASSERT_EQ(lazy.shortest_path(u, (u * 7) % 50), eager.shortest_path(u, (u * 7) % 50));
+        for (int v = 0; v < 50; ++v) {
+            ASSERT_EQ(lazy.contains_edge(u, v), eager.contains_edge(u, v));
+        }
+    }
+    ASSERT_EQ(grphx::csr_graph<int>(lazy).edge_count(), grphx::csr_graph<int>(eager).edge_count());
+}
+
+TEST_F(LazyRemovalTest, RemovedEdgeIsGoneFromBothEnds) {
+    grphx::undirected_graph<int> graph;
+    graph.set_lazy_removal(true);
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+
+    graph.remove_edge(2, 1);
+    ASSERT_FALSE(graph.contains_edge(1, 2));
+    ASSERT_FALSE(graph.contains_edge(2, 1));
+    ASSERT_EQ(graph.degree(2), 1);
+
+    graph.set_lazy_removal(false);
+    ASSERT_EQ(graph.tombstone_ratio(), 0.0);
+    ASSERT_EQ(graph.neighbors(2), std::list<int>({ 3 }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
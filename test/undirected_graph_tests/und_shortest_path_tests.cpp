@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include "grphx/grphx.hpp"
+
+// Define a test fixture for the graph
+class GraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+// Test case to verify the shortest_path function
+TEST_F(GraphTest, ShortestPathTest) {
+    grphx::undirected_graph<int> graph;
+    graph.add_edge(1, 2);
+    graph.add_edge(2, 3);
+    graph.add_edge(3, 4);
+    graph.add_edge(1, 5);
+    graph.add_edge(5, 4);
+    graph.add_vertex(6);
+
+    ASSERT_EQ(graph.shortest_path(4, 1), std::vector<int>({ 4, 5, 1 }));
+    ASSERT_EQ(graph.shortest_path(3, 1).size(), 3);
+    ASSERT_TRUE(graph.shortest_path(1, 6).empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}